@@ -1,10 +1,13 @@
 #include <assert.h>
 #include <immintrin.h>
 #include <stdlib.h>
+#include <string.h>
 #include <Vc/Vc>
 #include <simdpp/simd.h>
 #include <pure_simd.hpp>
 
+#include "dotProductTail.hpp"
+
 
 float dot_product(float * a, float * b, int length) {
     float sum = 0; 
@@ -18,10 +21,14 @@ float dot_product_unrolled(float * a, float * b, int length) {
     float sum0 = 0; 
     float sum1 = 0;
 
-    for (int i = 0; i < length; i += 2) {
+    int i = 0;
+    for (; i + 1 < length; i += 2) {
         sum0 += a[i] * b[i];
         sum1 += a[i+1] * b[i+1];
     }
+    if (i < length) {
+        sum0 += a[i] * b[i];
+    }
 
     return sum0 + sum1;
 }
@@ -45,98 +52,133 @@ float dot_product_openMP(float * a, float * b, int length) {
     return sum;
 }
 
+/* The SIMD implementations take any length and alignment. Full vectors are loaded unaligned, the
+ * last partial vector with loadTail_avx2 of dotProductTail.hpp, a masked load that leaves the lanes
+ * past the end zero and does not touch their memory, so the tail costs one vector step. */
+
+static inline float reduce_avx2(__m256 sum) {
+    float buffer[8];
+    _mm256_storeu_ps(buffer, sum);
+    return buffer[0] + buffer[1] + buffer[2] + buffer[3] + buffer[4] + buffer[5] +
+         buffer[6] + buffer[7];
+}
+
 // AVX2 implementation
 float dot_product_AVX2(float *a, float *b, size_t n) {
-    assert(n % 8 == 0);
     __m256 sum = _mm256_setzero_ps();
-     size_t limit = n - 7;
 
-     for (size_t i = 0; i < limit; i += 8) {
-      __m256 av = _mm256_load_ps(a + i);
-      __m256 bv = _mm256_load_ps(b + i);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256 av = _mm256_loadu_ps(a + i);
+      __m256 bv = _mm256_loadu_ps(b + i);
       sum = _mm256_fmadd_ps(av, bv, sum);
     }
 
-    float buffer[8];
-    _mm256_storeu_ps(buffer, sum);
-    return buffer[0] + buffer[1] + buffer[2] + buffer[3] + buffer[4] + buffer[5] +
-         buffer[6] + buffer[7];
+    if (i < n) {
+      sum = _mm256_fmadd_ps(loadTail_avx2(a + i, n - i), loadTail_avx2(b + i, n - i), sum);
+    }
+
+    return reduce_avx2(sum);
 }
 
 // AVX2 implementation
 float dot_product_AVX2_unrolled(float *a, float *b, size_t length) {
-    assert(length % 32 == 0);
     __m256 sum0 = _mm256_setzero_ps();
     __m256 sum1 = _mm256_setzero_ps();
     __m256 sum2 = _mm256_setzero_ps();
     __m256 sum3 = _mm256_setzero_ps();
 
-    for (size_t i = 0; i < length; i += 32) {
-        __m256 av0 = _mm256_load_ps(a + i);
-        __m256 bv0 = _mm256_load_ps(b + i);
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256 av0 = _mm256_loadu_ps(a + i);
+        __m256 bv0 = _mm256_loadu_ps(b + i);
         sum0 = _mm256_fmadd_ps(av0, bv0, sum0);
         
-        __m256 av1 = _mm256_load_ps(a + i + 8);
-        __m256 bv1 = _mm256_load_ps(b + i + 8);
+        __m256 av1 = _mm256_loadu_ps(a + i + 8);
+        __m256 bv1 = _mm256_loadu_ps(b + i + 8);
         sum1 = _mm256_fmadd_ps(av1, bv1, sum1);
 
-        __m256 av2 = _mm256_load_ps(a + i + 16);
-        __m256 bv2 = _mm256_load_ps(b + i + 16);
+        __m256 av2 = _mm256_loadu_ps(a + i + 16);
+        __m256 bv2 = _mm256_loadu_ps(b + i + 16);
         sum2 = _mm256_fmadd_ps(av2, bv2, sum2);
 
-        __m256 av3 = _mm256_load_ps(a + i + 24);
-        __m256 bv3 = _mm256_load_ps(b + i + 24);
+        __m256 av3 = _mm256_loadu_ps(a + i + 24);
+        __m256 bv3 = _mm256_loadu_ps(b + i + 24);
         sum3 = _mm256_fmadd_ps(av3, bv3, sum3);
     }
 
+    // Up to three full vectors and the partial one are left
+    for (; i + 8 <= length; i += 8) {
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0);
+    }
+    if (i < length) {
+        sum1 = _mm256_fmadd_ps(loadTail_avx2(a + i, length - i), loadTail_avx2(b + i, length - i), sum1);
+    }
+
     sum0 = _mm256_add_ps(sum0, sum1);
     sum2 = _mm256_add_ps(sum2, sum3);
     sum0 = _mm256_add_ps(sum0, sum2);
-    float buffer[8];
-    _mm256_storeu_ps(buffer, sum0);
-    return buffer[0] + buffer[1] + buffer[2] + buffer[3] + buffer[4] + buffer[5] +
-           buffer[6] + buffer[7];
+    return reduce_avx2(sum0);
+}
+
+// Loads the first remaining lanes of p with a masked gather, the other lanes are zero
+static inline Vc::float_v loadTail_vc(const float * p, size_t remaining) {
+    Vc::float_m mask = Vc::float_v::IndexesFromZero() < Vc::float_v((float) remaining);
+    Vc::float_v v = Vc::float_v::Zero();
+    v.gather(p, Vc::float_v::IndexType::IndexesFromZero(), mask);
+    return v;
 }
 
 // Vc implementation
 float dot_product_vc(float * a, float * b, size_t length) {
     size_t N = Vc::float_v::Size;
-    assert(length % N == 0);
-
-    Vc::float_v av, bv, sum;
-    for (size_t j = 0; j < length; j += N) {
-        for (size_t i = 0; i < N; i++) {
-            av[i] = a[i + j];
-            bv[i] = b[i + j];
-        }
+
+    Vc::float_v sum = Vc::float_v::Zero();
+    size_t j = 0;
+    for (; j + N <= length; j += N) {
+        Vc::float_v av(a + j, Vc::Unaligned);
+        Vc::float_v bv(b + j, Vc::Unaligned);
         sum += av * bv;
     }
 
+    if (j < length) {
+        sum += loadTail_vc(a + j, length - j) * loadTail_vc(b + j, length - j);
+    }
+
     return sum.sum();
 }
 
 // Vc implementation with loop unrolling.
 float dot_product_vc_unrolled(float * a, float * b, size_t length) {
     size_t N = Vc::float_v::Size;
-    assert(length % (N * 4) == 0);
-    Vc::float_v av0, av1, av2, av3, bv0, bv1, bv2, bv3, sum0, sum1, sum2, sum3;
-    for (size_t j = 0; j < length; j += N * 4) {
-        for (size_t i = 0; i < N; i++) {
-            av0[i] = a[i + j];
-            bv0[i] = b[i + j];
-            av1[i] = a[i + j + N];
-            bv1[i] = b[i + j + N];
-            av2[i] = a[i + j + (N * 2)];
-            bv2[i] = b[i + j + (N * 2)];
-            av3[i] = a[i + j + (N * 3)];
-            bv3[i] = a[i + j + (N * 3)];
-        }
+    Vc::float_v sum0 = Vc::float_v::Zero();
+    Vc::float_v sum1 = Vc::float_v::Zero();
+    Vc::float_v sum2 = Vc::float_v::Zero();
+    Vc::float_v sum3 = Vc::float_v::Zero();
+
+    size_t j = 0;
+    for (; j + N * 4 <= length; j += N * 4) {
+        Vc::float_v av0(a + j, Vc::Unaligned);
+        Vc::float_v bv0(b + j, Vc::Unaligned);
+        Vc::float_v av1(a + j + N, Vc::Unaligned);
+        Vc::float_v bv1(b + j + N, Vc::Unaligned);
+        Vc::float_v av2(a + j + (N * 2), Vc::Unaligned);
+        Vc::float_v bv2(b + j + (N * 2), Vc::Unaligned);
+        Vc::float_v av3(a + j + (N * 3), Vc::Unaligned);
+        Vc::float_v bv3(b + j + (N * 3), Vc::Unaligned);
         sum0 += av0 * bv0;
         sum1 += av1 * bv1;
         sum2 += av2 * bv2;
         sum3 += av3 * bv3;
     }
 
+    for (; j + N <= length; j += N) {
+        sum0 += Vc::float_v(a + j, Vc::Unaligned) * Vc::float_v(b + j, Vc::Unaligned);
+    }
+    if (j < length) {
+        sum1 += loadTail_vc(a + j, length - j) * loadTail_vc(b + j, length - j);
+    }
+
     float result0 = 0;
     float result1 = 0;
     result0 = sum0.sum() + sum1.sum();
@@ -145,17 +187,33 @@ float dot_product_vc_unrolled(float * a, float * b, size_t length) {
     return result0 + result1;
 }
 
+/* libsimdpp and pure_simd have no masked loads, the last partial vector is copied into a zeroed
+ * buffer and loaded from there, which is still a single vector step. */
+static inline void copyTail(float * buffer, const float * p, size_t remaining, size_t lanes) {
+    memset(buffer, 0, lanes * sizeof(float));
+    memcpy(buffer, p, remaining * sizeof(float));
+}
+
 //libsimdpp implementation
 float dot_product_libsimdpp(float * a, float * b, size_t length) {
     using namespace simdpp;
     const size_t N = SIMDPP_FAST_FLOAT32_SIZE; 
 
-    assert(length % N == 0); 
     float32<N> sum = splat(0);
 
-    for (size_t i = 0; i < length; i += N) {
-        float32<N> av = load(a + i);
-        float32<N> bv = load(b + i);
+    size_t i = 0;
+    for (; i + N <= length; i += N) {
+        float32<N> av = load_u(a + i);
+        float32<N> bv = load_u(b + i);
+        sum = fmadd(av, bv, sum);
+    }
+
+    if (i < length) {
+        float aTail[N], bTail[N];
+        copyTail(aTail, a + i, length - i, N);
+        copyTail(bTail, b + i, length - i, N);
+        float32<N> av = load_u(aTail);
+        float32<N> bv = load_u(bTail);
         sum = fmadd(av, bv, sum);
     }
 
@@ -166,30 +224,44 @@ float dot_product_libsimdpp_unrolled(float * a, float * b, size_t length) {
     using namespace simdpp;
     const size_t N = SIMDPP_FAST_FLOAT32_SIZE; 
 
-    assert(length % N * 4 == 0); 
     float32<N> sum0 = splat(0);
     float32<N> sum1 = splat(0);
     float32<N> sum2 = splat(0);
     float32<N> sum3 = splat(0);
 
-    for (size_t i = 0; i < length; i += N * 4) {
-        float32<N> av0 = load(a + i);
-        float32<N> bv0 = load(b + i);
+    size_t i = 0;
+    for (; i + N * 4 <= length; i += N * 4) {
+        float32<N> av0 = load_u(a + i);
+        float32<N> bv0 = load_u(b + i);
         sum0 = fmadd(av0, bv0, sum0);
 
-        float32<N> av1 = load(a + i + N);
-        float32<N> bv1 = load(b + i + N);
+        float32<N> av1 = load_u(a + i + N);
+        float32<N> bv1 = load_u(b + i + N);
         sum1 = fmadd(av1, bv1, sum1);
 
-        float32<N> av2 = load(a + i + (N * 2));
-        float32<N> bv2 = load(b + i + (N * 2));
+        float32<N> av2 = load_u(a + i + (N * 2));
+        float32<N> bv2 = load_u(b + i + (N * 2));
         sum2 = fmadd(av2, bv2, sum2);
 
-        float32<N> av3 = load(a + i + (N * 3));
-        float32<N> bv3 = load(b + i + (N * 3));
+        float32<N> av3 = load_u(a + i + (N * 3));
+        float32<N> bv3 = load_u(b + i + (N * 3));
         sum3 = fmadd(av3, bv3, sum3);
     }
 
+    for (; i + N <= length; i += N) {
+        float32<N> av = load_u(a + i);
+        float32<N> bv = load_u(b + i);
+        sum0 = fmadd(av, bv, sum0);
+    }
+    if (i < length) {
+        float aTail[N], bTail[N];
+        copyTail(aTail, a + i, length - i, N);
+        copyTail(bTail, b + i, length - i, N);
+        float32<N> av = load_u(aTail);
+        float32<N> bv = load_u(bTail);
+        sum1 = fmadd(av, bv, sum1);
+    }
+
     sum0 = add(sum0, sum1); 
     sum2 = add(sum2, sum3);
     sum0 = add(sum0, sum2); 
@@ -205,56 +277,87 @@ float dot_product_pure_simd(float * a, float * b, size_t length) {
 
     auto sum0 = scalar<TargetVec>(0.0f);
 
-    for (size_t i = 0; i < length; i += VECTOR_SIZE) {
+    size_t i = 0;
+    for (; i + VECTOR_SIZE <= length; i += VECTOR_SIZE) {
         auto av = load_from<TargetVec>(a + i);
         auto bv = load_from<TargetVec>(b + i);
         sum0 = (av * bv) + sum0; 
     }
 
+    if (i < length) {
+        float aTail[VECTOR_SIZE], bTail[VECTOR_SIZE];
+        copyTail(aTail, a + i, length - i, VECTOR_SIZE);
+        copyTail(bTail, b + i, length - i, VECTOR_SIZE);
+        auto av = load_from<TargetVec>(aTail);
+        auto bv = load_from<TargetVec>(bTail);
+        sum0 = (av * bv) + sum0;
+    }
+
     float result = sum<TargetVec>(sum0, 0.0f);
     return result;
 }
 
-#ifdef AVX512
+/* The AVX512 functions are compiled in every build, dot_product_intrinsics_dispatch only calls them
+ * on processors that support AVX512 */
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+
+// The mask selects the first remaining lanes (1 to 15), the others are zero and not read
+static inline __mmask16 tailMask_avx512(size_t remaining) {
+    return (__mmask16) ((1u << remaining) - 1);
+}
 
 float dot_product_avx512(float * a, float * b, size_t length) {
-    assert(length % 16 == 0);
     __m512 sum = _mm512_setzero_ps();
     
-    for (size_t i = 0; i < length; i += 16) {
-	__m512 av = _mm512_load_ps(a + i);
-	__m512 bv = _mm512_load_ps(b + i); 
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+	__m512 av = _mm512_loadu_ps(a + i);
+	__m512 bv = _mm512_loadu_ps(b + i); 
 	sum = _mm512_fmadd_ps(av, bv, sum);
     }
 
+    if (i < length) {
+        __mmask16 mask = tailMask_avx512(length - i);
+        sum = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), sum);
+    }
+
     return _mm512_reduce_add_ps(sum);
 }
 
 float dot_product_avx512_unrolled(float * a, float * b, size_t length) {
-    assert(length % 64 == 0);
     __m512 sum0 = _mm512_setzero_ps();
     __m512 sum1 = _mm512_setzero_ps();
     __m512 sum2 = _mm512_setzero_ps();
     __m512 sum3 = _mm512_setzero_ps();
 
-    for (size_t i = 0; i < length; i += 64) {
-        __m512 av0 = _mm512_load_ps(a + i);
-        __m512 bv0 = _mm512_load_ps(b + i);
+    size_t i = 0;
+    for (; i + 64 <= length; i += 64) {
+        __m512 av0 = _mm512_loadu_ps(a + i);
+        __m512 bv0 = _mm512_loadu_ps(b + i);
         sum0 = _mm512_fmadd_ps(av0, bv0, sum0);
 
-	__m512 av1 = _mm512_load_ps(a + i + 16);
-        __m512 bv1 = _mm512_load_ps(b + i + 16);
+	__m512 av1 = _mm512_loadu_ps(a + i + 16);
+        __m512 bv1 = _mm512_loadu_ps(b + i + 16);
         sum1 = _mm512_fmadd_ps(av1, bv1, sum1);
 
-	__m512 av2 = _mm512_load_ps(a + i + 32);
-        __m512 bv2 = _mm512_load_ps(b + i + 32);
+	__m512 av2 = _mm512_loadu_ps(a + i + 32);
+        __m512 bv2 = _mm512_loadu_ps(b + i + 32);
         sum2 = _mm512_fmadd_ps(av2, bv2, sum2);
 
-	__m512 av3 = _mm512_load_ps(a + i + 48);
-        __m512 bv3 = _mm512_load_ps(b + i + 48);
+	__m512 av3 = _mm512_loadu_ps(a + i + 48);
+        __m512 bv3 = _mm512_loadu_ps(b + i + 48);
         sum3 = _mm512_fmadd_ps(av3, bv3, sum3);
     }
 
+    for (; i + 16 <= length; i += 16) {
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), sum0);
+    }
+    if (i < length) {
+        __mmask16 mask = tailMask_avx512(length - i);
+        sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), sum1);
+    }
+
     sum0 = _mm512_add_ps(sum0, sum1);
     sum2 = _mm512_add_ps(sum2, sum3);
     sum0 = _mm512_add_ps(sum0, sum2);
@@ -262,28 +365,4 @@ float dot_product_avx512_unrolled(float * a, float * b, size_t length) {
     return _mm512_reduce_add_ps(sum0);
 }
 
-#endif
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+#pragma GCC pop_options
@@ -3,6 +3,8 @@
 
 #include <stdlib.h>
 
+/* All implementations take any length and alignment. The SIMD versions load the last partial
+ * vector with a mask, libsimdpp and pure_simd through a zero padded buffer. */
 
 /**
  * Calculates the dot product of two vectors.
@@ -169,9 +171,9 @@ float dot_product_libsimdpp_unrolled(float * a, float * b, size_t length);
 float dot_product_pure_simd(float * a, float * b, size_t length);
 
 
-#ifdef AVX512
 /**
- * Calculates the dot product of two vectors using avx512.
+ * Calculates the dot product of two vectors using avx512. Available in every build, the 
+ *  processor has to support AVX512F.
  *
  * @param a
  *          The first vector (float array)
@@ -186,7 +188,8 @@ float dot_product_avx512(float * a, float * b, size_t length);
 
 
 /**
- * Calculates the dot product of two vectors using avx512 with loop unrolling.
+ * Calculates the dot product of two vectors using avx512 with loop unrolling. Available in every
+ *  build, the processor has to support AVX512F.
  *
  * @param a
  *          The first vector (float array)
@@ -198,6 +201,5 @@ float dot_product_avx512(float * a, float * b, size_t length);
  * @return The dot product
 */
 float dot_product_avx512_unrolled(float * a, float * b, size_t length);
-#endif	// AVX512
 
 #endif  // dotProduct
@@ -0,0 +1,121 @@
+#include <immintrin.h>
+#include <math.h>
+
+#include "dotProductAccurate.hpp"
+#include "dotProductTail.hpp"
+
+#ifdef __FAST_MATH__
+#error "dotProductAccurate.cpp relies on IEEE rounding, compile it without -ffast-math"
+#endif
+
+/* Adds the products of av and bv to sum. The rounding error of the product comes exactly from the
+ * FMA, the one of the addition from Neumaier's branch free form: the smaller operand in magnitude
+ * is the one whose low bits got lost. Both go to the compensation. */
+static inline void compensatedStep_avx2(__m256 av, __m256 bv, __m256 & sum, __m256 & compensation) {
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+    __m256 product = _mm256_mul_ps(av, bv);
+    __m256 productError = _mm256_fmsub_ps(av, bv, product);
+
+    __m256 t = _mm256_add_ps(sum, product);
+    __m256 sumLarger = _mm256_cmp_ps(_mm256_and_ps(sum, absMask), _mm256_and_ps(product, absMask), _CMP_GE_OQ);
+    __m256 errorSumLarger = _mm256_add_ps(_mm256_sub_ps(sum, t), product);
+    __m256 errorProductLarger = _mm256_add_ps(_mm256_sub_ps(product, t), sum);
+    __m256 sumError = _mm256_blendv_ps(errorProductLarger, errorSumLarger, sumLarger);
+
+    compensation = _mm256_add_ps(compensation, _mm256_add_ps(sumError, productError));
+    sum = t;
+}
+
+// The scalar form of the same step for the final reduction of the lanes
+static inline void compensatedAdd(float x, float & sum, float & compensation) {
+    float t = sum + x;
+    if (fabsf(sum) >= fabsf(x)) {
+        compensation += (sum - t) + x;
+    } else {
+        compensation += (x - t) + sum;
+    }
+    sum = t;
+}
+
+float dot_product_compensated_AVX2(float * a, float * b, size_t length) {
+    // Two independent chains, the dependency of t on the previous sum is the bottleneck
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 compensation0 = _mm256_setzero_ps();
+    __m256 compensation1 = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        compensatedStep_avx2(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0, compensation0);
+        compensatedStep_avx2(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), sum1, compensation1);
+    }
+    if (i + 8 <= length) {
+        compensatedStep_avx2(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0, compensation0);
+        i += 8;
+    }
+    if (i < length) {
+        compensatedStep_avx2(loadTail_avx2(a + i, length - i), loadTail_avx2(b + i, length - i), sum1, compensation1);
+    }
+
+    float sums[16];
+    float compensations[8];
+    _mm256_storeu_ps(sums, sum0);
+    _mm256_storeu_ps(sums + 8, sum1);
+    _mm256_storeu_ps(compensations, _mm256_add_ps(compensation0, compensation1));
+
+    float sum = 0;
+    float compensation = 0;
+    for (size_t lane = 0; lane < 16; lane++) {
+        compensatedAdd(sums[lane], sum, compensation);
+    }
+    for (size_t lane = 0; lane < 8; lane++) {
+        compensation += compensations[lane];
+    }
+    return sum + compensation;
+}
+
+
+// The sum of a block of at most PAIRWISE_BLOCK elements, per lane
+static __m256 pairwiseBlock_avx2(float * a, float * b, size_t length) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), sum1);
+        sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 16), _mm256_loadu_ps(b + i + 16), sum2);
+        sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 24), _mm256_loadu_ps(b + i + 24), sum3);
+    }
+    for (; i + 8 <= length; i += 8) {
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum0);
+    }
+    if (i < length) {
+        sum1 = _mm256_fmadd_ps(loadTail_avx2(a + i, length - i), loadTail_avx2(b + i, length - i), sum1);
+    }
+
+    return _mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3));
+}
+
+// Splits at a block boundary into two halves with the same number of blocks, up to one
+static __m256 pairwise_avx2(float * a, float * b, size_t length) {
+    if (length <= PAIRWISE_BLOCK) {
+        return pairwiseBlock_avx2(a, b, length);
+    }
+    size_t blocks = (length + PAIRWISE_BLOCK - 1) / PAIRWISE_BLOCK;
+    size_t half = (blocks / 2) * PAIRWISE_BLOCK;
+    return _mm256_add_ps(pairwise_avx2(a, b, half), pairwise_avx2(a + half, b + half, length - half));
+}
+
+float dot_product_pairwise_AVX2(float * a, float * b, size_t length) {
+    __m256 sum = pairwise_avx2(a, b, length);
+
+    // The lanes in a tree as well, 8 to 4 to 2 to 1
+    __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    __m128 sum2 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+    __m128 sum1 = _mm_add_ss(sum2, _mm_movehdup_ps(sum2));
+    return _mm_cvtss_f32(sum1);
+}
@@ -0,0 +1,53 @@
+#ifndef dotProductAccurate
+#define dotProductAccurate
+
+#include <stdlib.h>
+
+/* Dot products that trade some throughput for accuracy. With u = 2^-24 the unit roundoff of float
+ * and gamma(m) = m * u / (1 - m * u), the plain kernels are only bounded by
+ * |result - a.b| <= gamma(length / lanes + c) * sum |a_i * b_i|, the error grows linearly with the
+ * number of terms each accumulator lane adds up. Both versions here take any length and alignment
+ * and have to be compiled without -ffast-math, which would remove the compensation terms. */
+
+// Elements summed directly before the pairwise tree starts, a multiple of 32
+#define PAIRWISE_BLOCK 256
+
+/**
+ * Calculates the dot product of two vectors with compensated summation using AVX2 intrinsics.
+ *  The rounding error of every product is recovered exactly with an FMA, the one of every addition
+ *  with Neumaier's variant of Kahan summation, and the compensations are added at the end. This is
+ *  the Dot2 algorithm of Ogita, Rump and Oishi, as accurate as a float computation in twice the
+ *  working precision followed by one rounding:
+ *  |result - a.b| <= u * |a.b| + gamma(length)^2 * sum |a_i * b_i|.
+ *
+ * @param a
+ *          The first vector (float array)
+ * @param b
+ *          The second vector (float array)
+ * @param length
+ *          The length of the array
+ *
+ * @return The dot product
+*/
+float dot_product_compensated_AVX2(float * a, float * b, size_t length);
+
+
+/**
+ * Calculates the dot product of two vectors with pairwise summation using AVX2 intrinsics. Blocks
+ *  of PAIRWISE_BLOCK elements are summed with 4 vector accumulators, the block sums are added in a
+ *  balanced tree. A term passes at most PAIRWISE_BLOCK / 32 + 9 roundings besides the tree, so
+ *  |result - a.b| <= gamma(PAIRWISE_BLOCK / 32 + 9 + ceil(log2(length / PAIRWISE_BLOCK))) * sum |a_i * b_i|,
+ *  which grows only logarithmically with the length at nearly the speed of the plain kernels.
+ *
+ * @param a
+ *          The first vector (float array)
+ * @param b
+ *          The second vector (float array)
+ * @param length
+ *          The length of the array
+ *
+ * @return The dot product
+*/
+float dot_product_pairwise_AVX2(float * a, float * b, size_t length);
+
+#endif  // dotProductAccurate
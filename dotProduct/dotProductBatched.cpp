@@ -0,0 +1,155 @@
+#include <immintrin.h>
+
+#include "dotProduct.hpp"
+#include "dotProductBatched.hpp"
+#include "dotProductTail.hpp"
+
+// Bytes of rows that are kept in the L2 cache while the queries pass over them
+#define BATCHED_ROW_TILE_BYTES (128 * 1024)
+
+/* The horizontal sums of 8 accumulators, lane k holds the sum of sk */
+static inline __m256 reduce8_avx2(__m256 s0, __m256 s1, __m256 s2, __m256 s3,
+                                  __m256 s4, __m256 s5, __m256 s6, __m256 s7) {
+    __m256 t0 = _mm256_hadd_ps(s0, s1);
+    __m256 t1 = _mm256_hadd_ps(s2, s3);
+    __m256 t2 = _mm256_hadd_ps(s4, s5);
+    __m256 t3 = _mm256_hadd_ps(s6, s7);
+    // Lanes s0 s1 s2 s3 of the lower halves, then the same of the upper halves
+    __m256 u0 = _mm256_hadd_ps(t0, t1);
+    __m256 u1 = _mm256_hadd_ps(t2, t3);
+    return _mm256_add_ps(_mm256_permute2f128_ps(u0, u1, 0x20), _mm256_permute2f128_ps(u0, u1, 0x31));
+}
+
+void dot_product_batched_AVX2(float * matrix, size_t rows, size_t length, float * query, float * result) {
+    size_t r = 0;
+    for (; r + 8 <= rows; r += 8) {
+        float * row = matrix + r * length;
+        __m256 s0 = _mm256_setzero_ps();
+        __m256 s1 = _mm256_setzero_ps();
+        __m256 s2 = _mm256_setzero_ps();
+        __m256 s3 = _mm256_setzero_ps();
+        __m256 s4 = _mm256_setzero_ps();
+        __m256 s5 = _mm256_setzero_ps();
+        __m256 s6 = _mm256_setzero_ps();
+        __m256 s7 = _mm256_setzero_ps();
+
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            __m256 q = _mm256_loadu_ps(query + i);
+            s0 = _mm256_fmadd_ps(_mm256_loadu_ps(row + i), q, s0);
+            s1 = _mm256_fmadd_ps(_mm256_loadu_ps(row + length + i), q, s1);
+            s2 = _mm256_fmadd_ps(_mm256_loadu_ps(row + 2 * length + i), q, s2);
+            s3 = _mm256_fmadd_ps(_mm256_loadu_ps(row + 3 * length + i), q, s3);
+            s4 = _mm256_fmadd_ps(_mm256_loadu_ps(row + 4 * length + i), q, s4);
+            s5 = _mm256_fmadd_ps(_mm256_loadu_ps(row + 5 * length + i), q, s5);
+            s6 = _mm256_fmadd_ps(_mm256_loadu_ps(row + 6 * length + i), q, s6);
+            s7 = _mm256_fmadd_ps(_mm256_loadu_ps(row + 7 * length + i), q, s7);
+        }
+        if (i < length) {
+            size_t remaining = length - i;
+            __m256 q = loadTail_avx2(query + i, remaining);
+            s0 = _mm256_fmadd_ps(loadTail_avx2(row + i, remaining), q, s0);
+            s1 = _mm256_fmadd_ps(loadTail_avx2(row + length + i, remaining), q, s1);
+            s2 = _mm256_fmadd_ps(loadTail_avx2(row + 2 * length + i, remaining), q, s2);
+            s3 = _mm256_fmadd_ps(loadTail_avx2(row + 3 * length + i, remaining), q, s3);
+            s4 = _mm256_fmadd_ps(loadTail_avx2(row + 4 * length + i, remaining), q, s4);
+            s5 = _mm256_fmadd_ps(loadTail_avx2(row + 5 * length + i, remaining), q, s5);
+            s6 = _mm256_fmadd_ps(loadTail_avx2(row + 6 * length + i, remaining), q, s6);
+            s7 = _mm256_fmadd_ps(loadTail_avx2(row + 7 * length + i, remaining), q, s7);
+        }
+
+        _mm256_storeu_ps(result + r, reduce8_avx2(s0, s1, s2, s3, s4, s5, s6, s7));
+    }
+
+    for (; r < rows; r++) {
+        result[r] = dot_product_AVX2_unrolled(matrix + r * length, query, length);
+    }
+}
+
+/* Queries q and q + 1 against the rows r to r + 3, the results are written to both result rows */
+static inline void batched_block_2x4_avx2(float * matrix, size_t rows, size_t length,
+                                          float * queries, size_t q, size_t r, float * result) {
+    float * q0 = queries + q * length;
+    float * q1 = q0 + length;
+    float * r0 = matrix + r * length;
+    float * r1 = r0 + length;
+    float * r2 = r1 + length;
+    float * r3 = r2 + length;
+
+    __m256 s00 = _mm256_setzero_ps();
+    __m256 s01 = _mm256_setzero_ps();
+    __m256 s02 = _mm256_setzero_ps();
+    __m256 s03 = _mm256_setzero_ps();
+    __m256 s10 = _mm256_setzero_ps();
+    __m256 s11 = _mm256_setzero_ps();
+    __m256 s12 = _mm256_setzero_ps();
+    __m256 s13 = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        __m256 a0 = _mm256_loadu_ps(q0 + i);
+        __m256 a1 = _mm256_loadu_ps(q1 + i);
+        __m256 b = _mm256_loadu_ps(r0 + i);
+        s00 = _mm256_fmadd_ps(a0, b, s00);
+        s10 = _mm256_fmadd_ps(a1, b, s10);
+        b = _mm256_loadu_ps(r1 + i);
+        s01 = _mm256_fmadd_ps(a0, b, s01);
+        s11 = _mm256_fmadd_ps(a1, b, s11);
+        b = _mm256_loadu_ps(r2 + i);
+        s02 = _mm256_fmadd_ps(a0, b, s02);
+        s12 = _mm256_fmadd_ps(a1, b, s12);
+        b = _mm256_loadu_ps(r3 + i);
+        s03 = _mm256_fmadd_ps(a0, b, s03);
+        s13 = _mm256_fmadd_ps(a1, b, s13);
+    }
+    if (i < length) {
+        size_t remaining = length - i;
+        __m256 a0 = loadTail_avx2(q0 + i, remaining);
+        __m256 a1 = loadTail_avx2(q1 + i, remaining);
+        __m256 b = loadTail_avx2(r0 + i, remaining);
+        s00 = _mm256_fmadd_ps(a0, b, s00);
+        s10 = _mm256_fmadd_ps(a1, b, s10);
+        b = loadTail_avx2(r1 + i, remaining);
+        s01 = _mm256_fmadd_ps(a0, b, s01);
+        s11 = _mm256_fmadd_ps(a1, b, s11);
+        b = loadTail_avx2(r2 + i, remaining);
+        s02 = _mm256_fmadd_ps(a0, b, s02);
+        s12 = _mm256_fmadd_ps(a1, b, s12);
+        b = loadTail_avx2(r3 + i, remaining);
+        s03 = _mm256_fmadd_ps(a0, b, s03);
+        s13 = _mm256_fmadd_ps(a1, b, s13);
+    }
+
+    __m256 sums = reduce8_avx2(s00, s01, s02, s03, s10, s11, s12, s13);
+    _mm_storeu_ps(result + q * rows + r, _mm256_castps256_ps128(sums));
+    _mm_storeu_ps(result + (q + 1) * rows + r, _mm256_extractf128_ps(sums, 1));
+}
+
+void dot_product_batched_queries_AVX2(float * matrix, size_t rows, size_t length,
+                                      float * queries, size_t queryCount, float * result) {
+    size_t tileRows = BATCHED_ROW_TILE_BYTES / (length * sizeof(float) + 1);
+    tileRows = (tileRows < 4) ? 4 : tileRows & ~(size_t) 3;
+
+    size_t pairedQueries = queryCount & ~(size_t) 1;
+    size_t fullRows = rows & ~(size_t) 3;
+    for (size_t tile = 0; tile < fullRows; tile += tileRows) {
+        size_t tileEnd = (tile + tileRows < fullRows) ? tile + tileRows : fullRows;
+        for (size_t q = 0; q < pairedQueries; q += 2) {
+            for (size_t r = tile; r < tileEnd; r += 4) {
+                batched_block_2x4_avx2(matrix, rows, length, queries, q, r, result);
+            }
+        }
+    }
+
+    // The rows that do not fill a block of 4
+    for (size_t q = 0; q < pairedQueries; q++) {
+        for (size_t r = fullRows; r < rows; r++) {
+            result[q * rows + r] = dot_product_AVX2_unrolled(queries + q * length, matrix + r * length, length);
+        }
+    }
+
+    // An odd query is left for the single query version
+    if (pairedQueries < queryCount) {
+        dot_product_batched_AVX2(matrix, rows, length, queries + pairedQueries * length, result + pairedQueries * rows);
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef dotProductBatched
+#define dotProductBatched
+
+#include <stdlib.h>
+
+/* Dot products of one or several queries with the rows of a matrix. The matrix is stored row
+ * major and contiguous, row r starts at matrix + r * length. Several rows are processed at once,
+ * so every loaded vector of a query is used for all of them instead of being loaded again for each
+ * row. Lengths and alignments are arbitrary, like for the single dot products. */
+
+/**
+ * Calculates the dot product of a query with every row of a matrix using AVX2 intrinsics. Blocks
+ *  of 8 rows share the loads of the query, the remaining rows use dot_product_AVX2_unrolled.
+ *
+ * @param matrix
+ *          The rows (float array of rows * length)
+ * @param rows
+ *          The number of rows
+ * @param length
+ *          The length of a row and of the query
+ * @param query
+ *          The query vector (float array)
+ * @param result
+ *          The dot products, one per row (float array of rows)
+*/
+void dot_product_batched_AVX2(float * matrix, size_t rows, size_t length, float * query, float * result);
+
+
+/**
+ * Calculates the dot product of several queries with every row of a matrix using AVX2
+ *  intrinsics. Blocks of 2 queries and 4 rows share their loads, and the rows are processed in
+ *  tiles that stay in the L2 cache while all queries pass over them.
+ *
+ * @param matrix
+ *          The rows (float array of rows * length)
+ * @param rows
+ *          The number of rows
+ * @param length
+ *          The length of a row and of a query
+ * @param queries
+ *          The queries, stored like the rows (float array of queryCount * length)
+ * @param queryCount
+ *          The number of queries
+ * @param result
+ *          The dot products, result[q * rows + r] belongs to query q and row r
+ *          (float array of queryCount * rows)
+*/
+void dot_product_batched_queries_AVX2(float * matrix, size_t rows, size_t length,
+                                      float * queries, size_t queryCount, float * result);
+
+#endif  // dotProductBatched
@@ -5,11 +5,16 @@
 #include <hwy/highway.h>
 #include "hwy/nanobenchmark.h"  // Unpredictable1
 #include <numeric>  // iota
+#include <thread>
 #include <Vc/Vc>
 #include <simdpp/simd.h>
 
 #include "dotProduct.hpp"
 #include "dotProductHighway.hpp"
+#include "dotProductDispatch.hpp"
+#include "dotProductThreaded.hpp"
+#include "dotProductBatched.hpp"
+#include "dotProductAccurate.hpp"
 #include "../utils/utils.hpp"
 
 using std::chrono::high_resolution_clock;
@@ -144,6 +149,39 @@ static void BM_Dot_Product_Highway_Unrolled(benchmark::State& state) {
 BENCHMARK(BM_Dot_Product_Highway_Unrolled);
 
 
+// The label shows the target which was chosen at runtime
+static void BM_Dot_Product_Highway_Dispatch(benchmark::State& state) {
+
+    hwy::AlignedFreeUniquePtr<float []> a = hwy::AllocateAligned<float>(length * 2);
+    float * b = &a[0] + length;
+
+    fillFloatArrayRandom(a.get(), length);
+    fillFloatArrayRandom(b, length);
+
+    for (auto _ : state) {
+        highway_dot_product_dispatch(&a[0], b, length);
+    }
+    state.SetLabel(highway_dot_product_dispatch_target());
+}
+BENCHMARK(BM_Dot_Product_Highway_Dispatch);
+
+
+static void BM_Dot_Product_Intrinsics_Dispatch(benchmark::State& state) {
+
+    hwy::AlignedFreeUniquePtr<float []> a = hwy::AllocateAligned<float>(length * 2);
+    float * b = &a[0] + length;
+
+    fillFloatArrayRandom(a.get(), length);
+    fillFloatArrayRandom(b, length);
+
+    for (auto _ : state) {
+        dot_product_intrinsics_dispatch(&a[0], b, length);
+    }
+    state.SetLabel(dot_product_intrinsics_dispatch_target());
+}
+BENCHMARK(BM_Dot_Product_Intrinsics_Dispatch);
+
+
 static void BM_Dot_Product_Vc(benchmark::State& state) {
 
     float a[length];
@@ -255,4 +293,212 @@ BENCHMARK(BM_Dot_Product_AVX512_Unrolled);
 #endif	// AVX512
 
 
+/* Lengths around 768 at an aligned and an unaligned offset. 769 to 775 end in a masked partial
+ * vector and have to run about as fast as 776, the next multiple of 8, which does the same number
+ * of vector steps. 784 is one step more for AVX2, 800 for AVX512. */
+static void TailArguments(benchmark::internal::Benchmark* b) {
+    for (int offset : {0, 1}) {
+        for (int tailLength : {768, 769, 772, 775, 776, 784, 800}) {
+            b->Args({tailLength, offset});
+        }
+    }
+}
+
+template <typename DotProduct>
+static void BM_Dot_Product_Tail(benchmark::State& state, DotProduct kernel) {
+    size_t tailLength = state.range(0);
+    size_t offset = state.range(1);
+
+    hwy::AlignedFreeUniquePtr<float []> a = hwy::AllocateAligned<float>(tailLength + 16);
+    hwy::AlignedFreeUniquePtr<float []> b = hwy::AllocateAligned<float>(tailLength + 16);
+    fillFloatArrayRandom(a.get(), tailLength + 16);
+    fillFloatArrayRandom(b.get(), tailLength + 16);
+
+    for (auto _ : state) {
+        float result = kernel(&a[offset], &b[offset], tailLength);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * tailLength);
+}
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, AVX2, dot_product_AVX2)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, AVX2_Unrolled, dot_product_AVX2_unrolled)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, Highway, highway_dot_product)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, Highway_Unrolled, highway_dot_product_unrolled)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, Highway_Dispatch, highway_dot_product_dispatch)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, Vc, dot_product_vc)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, Libsimdpp, dot_product_libsimdpp)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, Pure_Simd, dot_product_pure_simd)->Apply(TailArguments);
+#ifdef AVX512
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, AVX512, dot_product_avx512)->Apply(TailArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Tail, AVX512_Unrolled, dot_product_avx512_unrolled)->Apply(TailArguments);
+#endif	// AVX512
+
+
+/* Lengths from 16 KiB per vector, within L1, to 256 MiB per vector, far beyond the last level
+ * cache, each with powers of 2 up to all hardware threads. Short vectors run single threaded. */
+static void ThreadedArguments(benchmark::internal::Benchmark* b) {
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int64_t threadedLength = 1 << 12; threadedLength <= 1 << 26; threadedLength *= 4) {
+        for (int threads = 1; threads < maxThreads; threads *= 2) {
+            b->Args({threadedLength, threads});
+        }
+        b->Args({threadedLength, maxThreads});
+    }
+}
+
+template <typename DotProduct>
+static void BM_Dot_Product_Threaded(benchmark::State& state, DotProduct kernel) {
+    size_t threadedLength = state.range(0);
+    size_t threads = state.range(1);
+
+    float * a = allocateHugePageArray(threadedLength);
+    float * b = allocateHugePageArray(threadedLength);
+    fillFloatArrayRandom(a, threadedLength);
+    fillFloatArrayRandom(b, threadedLength);
+
+    for (auto _ : state) {
+        float result = dot_product_threaded(kernel, a, b, threadedLength, threads);
+        benchmark::DoNotOptimize(result);
+    }
+    size_t bytes = 2 * threadedLength * sizeof(float);
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.counters["GB"] = benchmark::Counter(state.iterations() * bytes / 1e9, benchmark::Counter::kIsRate);
+
+    free(a);
+    free(b);
+}
+BENCHMARK_CAPTURE(BM_Dot_Product_Threaded, AVX2_Unrolled, dot_product_AVX2_unrolled)
+    ->Apply(ThreadedArguments)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Dot_Product_Threaded, Intrinsics_Dispatch, dot_product_intrinsics_dispatch)
+    ->Apply(ThreadedArguments)->UseRealTime();
+
+
+/* 1024 rows from 256 B each, which fit the L1 cache together with the query, to 16 KiB each, so
+ * the matrix streams from memory. The queries variants take 16 queries. Items are multiply-adds. */
+static void BatchedArguments(benchmark::internal::Benchmark* b) {
+    for (int rowLength : {64, 256, 1024, 4096}) {
+        b->Args({1024, rowLength});
+    }
+}
+
+const size_t batchedQueries = 16;
+
+static void BM_Dot_Product_Batched_Loop(benchmark::State& state) {
+    size_t rows = state.range(0);
+    size_t rowLength = state.range(1);
+
+    hwy::AlignedFreeUniquePtr<float []> matrix = hwy::AllocateAligned<float>(rows * rowLength);
+    hwy::AlignedFreeUniquePtr<float []> query = hwy::AllocateAligned<float>(rowLength);
+    hwy::AlignedFreeUniquePtr<float []> result = hwy::AllocateAligned<float>(rows);
+    fillFloatArrayRandom(matrix.get(), rows * rowLength);
+    fillFloatArrayRandom(query.get(), rowLength);
+
+    for (auto _ : state) {
+        for (size_t r = 0; r < rows; r++) {
+            result[r] = dot_product_AVX2_unrolled(&matrix[r * rowLength], query.get(), rowLength);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * rows * rowLength);
+}
+BENCHMARK(BM_Dot_Product_Batched_Loop)->Apply(BatchedArguments);
+
+static void BM_Dot_Product_Batched_AVX2(benchmark::State& state) {
+    size_t rows = state.range(0);
+    size_t rowLength = state.range(1);
+
+    hwy::AlignedFreeUniquePtr<float []> matrix = hwy::AllocateAligned<float>(rows * rowLength);
+    hwy::AlignedFreeUniquePtr<float []> query = hwy::AllocateAligned<float>(rowLength);
+    hwy::AlignedFreeUniquePtr<float []> result = hwy::AllocateAligned<float>(rows);
+    fillFloatArrayRandom(matrix.get(), rows * rowLength);
+    fillFloatArrayRandom(query.get(), rowLength);
+
+    for (auto _ : state) {
+        dot_product_batched_AVX2(matrix.get(), rows, rowLength, query.get(), result.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * rows * rowLength);
+}
+BENCHMARK(BM_Dot_Product_Batched_AVX2)->Apply(BatchedArguments);
+
+static void BM_Dot_Product_Batched_Queries_Loop(benchmark::State& state) {
+    size_t rows = state.range(0);
+    size_t rowLength = state.range(1);
+
+    hwy::AlignedFreeUniquePtr<float []> matrix = hwy::AllocateAligned<float>(rows * rowLength);
+    hwy::AlignedFreeUniquePtr<float []> queries = hwy::AllocateAligned<float>(batchedQueries * rowLength);
+    hwy::AlignedFreeUniquePtr<float []> result = hwy::AllocateAligned<float>(batchedQueries * rows);
+    fillFloatArrayRandom(matrix.get(), rows * rowLength);
+    fillFloatArrayRandom(queries.get(), batchedQueries * rowLength);
+
+    for (auto _ : state) {
+        for (size_t q = 0; q < batchedQueries; q++) {
+            for (size_t r = 0; r < rows; r++) {
+                result[q * rows + r] = dot_product_AVX2_unrolled(&matrix[r * rowLength], &queries[q * rowLength],
+                                                                 rowLength);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * batchedQueries * rows * rowLength);
+}
+BENCHMARK(BM_Dot_Product_Batched_Queries_Loop)->Apply(BatchedArguments);
+
+static void BM_Dot_Product_Batched_Queries_AVX2(benchmark::State& state) {
+    size_t rows = state.range(0);
+    size_t rowLength = state.range(1);
+
+    hwy::AlignedFreeUniquePtr<float []> matrix = hwy::AllocateAligned<float>(rows * rowLength);
+    hwy::AlignedFreeUniquePtr<float []> queries = hwy::AllocateAligned<float>(batchedQueries * rowLength);
+    hwy::AlignedFreeUniquePtr<float []> result = hwy::AllocateAligned<float>(batchedQueries * rows);
+    fillFloatArrayRandom(matrix.get(), rows * rowLength);
+    fillFloatArrayRandom(queries.get(), batchedQueries * rowLength);
+
+    for (auto _ : state) {
+        dot_product_batched_queries_AVX2(matrix.get(), rows, rowLength, queries.get(), batchedQueries, result.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * batchedQueries * rows * rowLength);
+}
+BENCHMARK(BM_Dot_Product_Batched_Queries_AVX2)->Apply(BatchedArguments);
+
+
+/* The throughput cost of the accurate versions next to the plain unrolled kernel, from the L1
+ * cache to memory. The error counter is the distance to the exact result relative to
+ * sum |a_i * b_i|, the quantity the error bounds scale. */
+static void AccuracyArguments(benchmark::internal::Benchmark* b) {
+    for (int accuracyLength : {2048, 65536, 1 << 20}) {
+        b->Arg(accuracyLength);
+    }
+}
+
+template <typename DotProduct>
+static void BM_Dot_Product_Accuracy(benchmark::State& state, DotProduct kernel) {
+    size_t accuracyLength = state.range(0);
+
+    hwy::AlignedFreeUniquePtr<float []> a = hwy::AllocateAligned<float>(accuracyLength);
+    hwy::AlignedFreeUniquePtr<float []> b = hwy::AllocateAligned<float>(accuracyLength);
+    fillFloatArrayRandom(a.get(), accuracyLength);
+    fillFloatArrayRandom(b.get(), accuracyLength);
+
+    float result = 0;
+    for (auto _ : state) {
+        result = kernel(a.get(), b.get(), accuracyLength);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * accuracyLength);
+
+    long double exact = 0;
+    long double sumAbs = 0;
+    for (size_t i = 0; i < accuracyLength; i++) {
+        double product = (double) a[i] * b[i];
+        exact += product;
+        sumAbs += std::abs(product);
+    }
+    state.counters["error"] = (double) (std::abs(result - exact) / sumAbs);
+}
+BENCHMARK_CAPTURE(BM_Dot_Product_Accuracy, AVX2_Unrolled, dot_product_AVX2_unrolled)->Apply(AccuracyArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Accuracy, Compensated_AVX2, dot_product_compensated_AVX2)->Apply(AccuracyArguments);
+BENCHMARK_CAPTURE(BM_Dot_Product_Accuracy, Pairwise_AVX2, dot_product_pairwise_AVX2)->Apply(AccuracyArguments);
+
 BENCHMARK_MAIN(); 
@@ -0,0 +1,62 @@
+// Compiles this file once for every Highway target, HWY_ONCE is only true in the last pass
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "dotProduct/dotProductDispatch.cpp"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+
+#include "dotProductHighway-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace dotProductTargets {
+namespace HWY_NAMESPACE {
+
+// highway_dot_product compiled for this target
+float DotProduct(const float* const HWY_RESTRICT pa, 
+                          const float* const HWY_RESTRICT pb, size_t numItems) {
+  return DotProductKernel(pa, pb, numItems);
+}
+
+const char * DotProductTarget() {
+  return hwy::TargetName(HWY_TARGET);
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace dotProductTargets
+HWY_AFTER_NAMESPACE();
+
+
+#if HWY_ONCE
+#include "dotProduct.hpp"
+#include "dotProductDispatch.hpp"
+
+namespace dotProductTargets {
+HWY_EXPORT(DotProduct);
+HWY_EXPORT(DotProductTarget);
+}  // namespace dotProductTargets
+
+float highway_dot_product_dispatch(const float * pa, const float * pb, size_t numItems) {
+  return HWY_DYNAMIC_DISPATCH(dotProductTargets::DotProduct)(pa, pb, numItems);
+}
+
+const char * highway_dot_product_dispatch_target() {
+  return HWY_DYNAMIC_DISPATCH(dotProductTargets::DotProductTarget)();
+}
+
+
+static bool supportsAVX512() {
+  // Evaluated once, CPUID does not change while the program runs
+  static const bool supported = __builtin_cpu_supports("avx512f");
+  return supported;
+}
+
+float dot_product_intrinsics_dispatch(float * a, float * b, size_t length) {
+  if (supportsAVX512()) {
+    return dot_product_avx512_unrolled(a, b, length);
+  }
+  return dot_product_AVX2_unrolled(a, b, length);
+}
+
+const char * dot_product_intrinsics_dispatch_target() {
+  return supportsAVX512() ? "AVX512" : "AVX2";
+}
+#endif  // HWY_ONCE
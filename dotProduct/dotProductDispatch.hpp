@@ -0,0 +1,54 @@
+#ifndef dotProductDispatch
+#define dotProductDispatch
+
+#include <stddef.h>
+
+/* Dot products that choose their instruction set when the program runs. The Highway version is
+ * compiled for every target Highway supports on this architecture, the intrinsics version chooses 
+ * between the hand written AVX2 and AVX512 code with CPUID. */
+
+/**
+ * Calculates the dot product of two vectors using google highway with dynamic dispatch.
+ * 
+ * @param pa 
+ *          The first vector
+ * @param pb 
+ *          The second vector
+ * @param numItems
+ *          The number of items in each vector
+ *
+ * @return The dot product
+ */
+float highway_dot_product_dispatch(const float * pa, const float * pb, size_t numItems);
+
+/**
+ * Returns the name of the Highway target highway_dot_product_dispatch runs on this processor.
+ *
+ * @return  The name of the target
+*/
+const char * highway_dot_product_dispatch_target();
+
+
+/**
+ * Calculates the dot product of two vectors with dot_product_avx512_unrolled on processors 
+ *  that support AVX512F and dot_product_AVX2_unrolled otherwise.
+ * 
+ * @param a
+ *          The first vector (float array)
+ * @param b
+ *          The second vector (float array)
+ * @param length
+ *          The length of the array
+ * 
+ * @return The dot product 
+*/
+float dot_product_intrinsics_dispatch(float * a, float * b, size_t length);
+
+/**
+ * Returns the instruction set dot_product_intrinsics_dispatch uses on this processor.
+ *
+ * @return  "AVX512" or "AVX2"
+*/
+const char * dot_product_intrinsics_dispatch_target();
+
+#endif  // dotProductDispatch
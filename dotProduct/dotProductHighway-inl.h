@@ -0,0 +1,50 @@
+// Included once per Highway target by foreach_target, so it has no ordinary include guard.
+// The toggle guard lets every target compile the code below once.
+#if defined(DOT_PRODUCT_HIGHWAY_INL_H_TARGET) == defined(HWY_TARGET_TOGGLE)
+#ifdef DOT_PRODUCT_HIGHWAY_INL_H_TARGET
+#undef DOT_PRODUCT_HIGHWAY_INL_H_TARGET
+#else
+#define DOT_PRODUCT_HIGHWAY_INL_H_TARGET
+#endif
+
+#include <stddef.h>
+#include <hwy/highway.h>
+
+/* The Highway dot product, shared by highway_dot_product in the static target and
+ * highway_dot_product_dispatch, which compiles it for every target. */
+
+HWY_BEFORE_NAMESPACE();
+namespace dotProductTargets {
+namespace HWY_NAMESPACE {
+
+HWY_INLINE float DotProductKernel(const float* const HWY_RESTRICT pa, 
+                          const float* const HWY_RESTRICT pb, size_t numItems) {
+  using namespace hwy::HWY_NAMESPACE;
+
+  const ScalableTag<float> d;
+  const size_t N = Lanes(d);
+  using V = decltype(Zero(d));
+
+  V sum = Zero(d);
+  size_t i = 0;
+  for (; i + N <= numItems; i += N) {
+    const auto a = LoadU(d, pa + i);
+    const auto b = LoadU(d, pb + i);
+    sum = MulAdd(a, b, sum);
+  }
+
+  // LoadN zeroes the lanes past the end and does not read their memory
+  if (i < numItems) {
+    const auto a = LoadN(d, pa + i, numItems - i);
+    const auto b = LoadN(d, pb + i, numItems - i);
+    sum = MulAdd(a, b, sum);
+  }
+
+  return GetLane(SumOfLanes(d, sum));
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace dotProductTargets
+HWY_AFTER_NAMESPACE();
+
+#endif  // DOT_PRODUCT_HIGHWAY_INL_H_TARGET
@@ -3,6 +3,7 @@
 #include "hwy/nanobenchmark.h"  // Unpredictable1
 
 #include "dotProductHighway.hpp"
+#include "dotProductHighway-inl.h"
 
 //#include <benchmark/benchmark.h>
 #include <chrono>
@@ -15,18 +16,7 @@ using namespace HWY_NAMESPACE;
 
 HWY_ATTR float highway_dot_product(const float* const HWY_RESTRICT pa, 
                           const float* const HWY_RESTRICT pb, size_t numItems) {
-  const ScalableTag<float> d;
-  const size_t N = Lanes(d);
-  using V = decltype(Zero(d));
-
-  V sum = Zero(d);
-  for (size_t i = 0; i < numItems; i += N) {
-    const auto a = Load(d, pa + i);
-    const auto b = Load(d, pb + i);
-    sum = MulAdd(a, b, sum);
-  }
-
-  return GetLane(SumOfLanes(d, sum));;
+  return dotProductTargets::HWY_NAMESPACE::DotProductKernel(pa, pb, numItems);
 }
 
 float highway_dot_product_unrolled(const float* const HWY_RESTRICT pa, 
@@ -39,20 +29,29 @@ float highway_dot_product_unrolled(const float* const HWY_RESTRICT pa,
   V sum1 = Zero(d);
   V sum2 = Zero(d);
   V sum3 = Zero(d);
-  for (size_t i = 0; i < numItems; i += 4 * N) {
-    const auto a0 = Load(d, pa + i + 0 * N);
-    const auto b0 = Load(d, pb + i + 0 * N);
+  size_t i = 0;
+  for (; i + 4 * N <= numItems; i += 4 * N) {
+    const auto a0 = LoadU(d, pa + i + 0 * N);
+    const auto b0 = LoadU(d, pb + i + 0 * N);
     sum0 = MulAdd(a0, b0, sum0);
-    const auto a1 = Load(d, pa + i + 1 * N);
-    const auto b1 = Load(d, pb + i + 1 * N);
+    const auto a1 = LoadU(d, pa + i + 1 * N);
+    const auto b1 = LoadU(d, pb + i + 1 * N);
     sum1 = MulAdd(a1, b1, sum1);
-    const auto a2 = Load(d, pa + i + 2 * N);
-    const auto b2 = Load(d, pb + i + 2 * N);
+    const auto a2 = LoadU(d, pa + i + 2 * N);
+    const auto b2 = LoadU(d, pb + i + 2 * N);
     sum2 = MulAdd(a2, b2, sum2);
-    const auto a3 = Load(d, pa + i + 3 * N);
-    const auto b3 = Load(d, pb + i + 3 * N);
+    const auto a3 = LoadU(d, pa + i + 3 * N);
+    const auto b3 = LoadU(d, pb + i + 3 * N);
     sum3 = MulAdd(a3, b3, sum3);
   }
+
+  // Up to three full vectors and the partial one are left
+  for (; i + N <= numItems; i += N) {
+    sum0 = MulAdd(LoadU(d, pa + i), LoadU(d, pb + i), sum0);
+  }
+  if (i < numItems) {
+    sum1 = MulAdd(LoadN(d, pa + i, numItems - i), LoadN(d, pb + i, numItems - i), sum1);
+  }
   
   // Reduction tree: sum of all accumulators by pairs into sum0.
   sum0 = Add(sum0, sum1);
@@ -0,0 +1,16 @@
+#ifndef dotProductTail
+#define dotProductTail
+
+#include <stddef.h>
+#include <immintrin.h>
+
+/* The last partial vector of the AVX2 dot products is loaded masked, the lanes past the end stay
+ * zero and their memory is not touched. Shared by all files with AVX2 dot product kernels. */
+
+// Loads the first remaining lanes (1 to 7) of p, the other lanes are zero
+static inline __m256 loadTail_avx2(const float * p, size_t remaining) {
+    __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int) remaining), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    return _mm256_maskload_ps(p, mask);
+}
+
+#endif  // dotProductTail
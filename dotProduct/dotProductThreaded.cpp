@@ -0,0 +1,138 @@
+#include <assert.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dotProductThreaded.hpp"
+
+/* Threads that stay alive between calls, so short vectors do not pay for creating threads. A job
+ * is published by increasing the generation, the workers with an index below the requested count
+ * run it, the caller takes part as thread 0 and waits for the others. */
+class WorkerPool {
+    public:
+        typedef void (*Task)(void * job, size_t id);
+
+        ~WorkerPool() {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (std::thread & t : workers) {
+                t.join();
+            }
+        }
+
+        void run(size_t threads, Task task, void * job) {
+            assert(threads > 0);
+            // One job at a time, concurrent callers queue up here
+            std::lock_guard<std::mutex> runGuard(runLock);
+
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                while (workers.size() < threads - 1) {
+                    workers.emplace_back(&WorkerPool::worker, this, workers.size(), generation);
+                }
+                currentTask = task;
+                currentJob = job;
+                active = threads - 1;
+                pending = threads - 1;
+                generation++;
+            }
+            wake.notify_all();
+
+            task(job, 0);
+
+            std::unique_lock<std::mutex> guard(lock);
+            done.wait(guard, [this] { return pending == 0; });
+        }
+
+    private:
+        void worker(size_t index, size_t seen) {
+            std::unique_lock<std::mutex> guard(lock);
+            while (1) {
+                wake.wait(guard, [&] { return stopping || generation != seen; });
+                if (stopping) {
+                    return;
+                }
+                seen = generation;
+                if (index >= active) {
+                    continue;
+                }
+
+                guard.unlock();
+                currentTask(currentJob, index + 1);
+                guard.lock();
+
+                if (--pending == 0) {
+                    done.notify_one();
+                }
+            }
+        }
+
+        std::mutex runLock;
+        std::mutex lock;
+        std::condition_variable wake;
+        std::condition_variable done;
+        std::vector<std::thread> workers;
+        Task currentTask = nullptr;
+        void * currentJob = nullptr;
+        size_t active = 0;
+        size_t pending = 0;
+        size_t generation = 0;
+        bool stopping = false;
+};
+
+struct DotProductJob {
+    DotProductKernel kernel;
+    float * a;
+    float * b;
+    size_t length;
+    size_t chunks;
+    std::atomic<size_t> nextChunk;
+    std::vector<double> partials;
+};
+
+static void dotProductChunks(void * data, size_t id) {
+    (void) id;
+    DotProductJob & job = *(DotProductJob *) data;
+
+    size_t chunk;
+    while ((chunk = job.nextChunk.fetch_add(1, std::memory_order_relaxed)) < job.chunks) {
+        size_t begin = chunk * DOT_CHUNK_LENGTH;
+        size_t chunkLength = (job.length - begin < DOT_CHUNK_LENGTH) ? job.length - begin : DOT_CHUNK_LENGTH;
+        job.partials[chunk] = job.kernel(job.a + begin, job.b + begin, chunkLength);
+    }
+}
+
+float dot_product_threaded(DotProductKernel kernel, float * a, float * b, size_t length, size_t threads) {
+    assert(threads > 0);
+    if (length <= DOT_CHUNK_LENGTH) {
+        return kernel(a, b, length);
+    }
+
+    DotProductJob job;
+    job.kernel = kernel;
+    job.a = a;
+    job.b = b;
+    job.length = length;
+    job.chunks = (length + DOT_CHUNK_LENGTH - 1) / DOT_CHUNK_LENGTH;
+    job.nextChunk = 0;
+    job.partials.resize(job.chunks);
+
+    if (threads > job.chunks) {
+        threads = job.chunks;
+    }
+
+    static WorkerPool pool;
+    pool.run(threads, dotProductChunks, &job);
+
+    // The partial sums are added in chunk order, independent of which thread computed them
+    double sum = 0;
+    for (double partial : job.partials) {
+        sum += partial;
+    }
+    return (float) sum;
+}
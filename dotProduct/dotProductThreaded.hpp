@@ -0,0 +1,39 @@
+#ifndef dotProductThreaded
+#define dotProductThreaded
+
+#include <stddef.h>
+
+/* Dot products of long vectors split into chunks of DOT_CHUNK_LENGTH elements. The threads of a
+ * persistent pool take chunks from a shared counter and run a single threaded kernel on each, the
+ * kernel keeps its unrolled accumulators in registers. Every chunk writes its partial sum to its
+ * own slot and the slots are added in chunk order, so the result is the same for every thread
+ * count and every schedule. */
+
+// Elements per chunk, 2 x 256 KiB of input stay within the L2 cache
+#define DOT_CHUNK_LENGTH (64 * 1024)
+
+/**
+ * A single threaded dot product, e.g. dot_product_AVX2_unrolled or dot_product_intrinsics_dispatch.
+*/
+typedef float (*DotProductKernel)(float * a, float * b, size_t length);
+
+/**
+ * Calculates the dot product of two vectors with several threads. Vectors of up to one chunk
+ *  are handed to the kernel directly.
+ *
+ * @param kernel
+ *          The kernel computing the partial sum of a chunk
+ * @param a
+ *          The first vector (float array)
+ * @param b
+ *          The second vector (float array)
+ * @param length
+ *          The length of the array
+ * @param threads
+ *          The number of threads including the calling one
+ *
+ * @return The dot product
+*/
+float dot_product_threaded(DotProductKernel kernel, float * a, float * b, size_t length, size_t threads);
+
+#endif  // dotProductThreaded
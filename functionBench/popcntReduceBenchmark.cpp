@@ -4,6 +4,7 @@
 
 #include "hwy/aligned_allocator.h"
 #include "populationCount.hpp"
+#include "populationCountDispatch.hpp"
 
 #define BENCHMARK_REPETITIONS 10
 
@@ -179,6 +180,33 @@ BENCHMARK(BM_Highway_Store_Popcnt)
     return *(std::min_element(std::begin(v), std::end(v)));
     });;
 
+
+// Counts a whole array, the label shows the target which was chosen at runtime
+static void BM_Highway_Popcnt_Dispatch(benchmark::State& state) {
+    const size_t count = 4096;
+    AlignedFreeUniquePtr<uint32_t []> vec = AllocateAligned<uint32_t>(count);
+    for(size_t i = 0; i < count; i++) {
+        vec[i] = 0xFFFFFFFF;
+    }
+
+    uint32_t result = 0; 
+    for (auto _ : state) {
+        result = highway_popcnt_dispatch(&vec[0], count);
+        benchmark::DoNotOptimize(result);
+    }
+    assert(result == count * 32);
+    state.SetLabel(highway_popcnt_dispatch_target());
+}
+BENCHMARK(BM_Highway_Popcnt_Dispatch)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
 /*
 static void BM_Highway_Extract(benchmark::State& state) {
 
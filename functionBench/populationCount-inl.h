@@ -0,0 +1,81 @@
+// Included once per Highway target by foreach_target, so it has no ordinary include guard.
+// The toggle guard lets every target compile the code below once.
+#if defined(POPULATION_COUNT_INL_H_TARGET) == defined(HWY_TARGET_TOGGLE)
+#ifdef POPULATION_COUNT_INL_H_TARGET
+#undef POPULATION_COUNT_INL_H_TARGET
+#else
+#define POPULATION_COUNT_INL_H_TARGET
+#endif
+
+#include <stdint.h>
+#include <hwy/highway.h>
+
+/* The Highway population counts of one vector, shared by the highway_*popcnt* functions of the
+ * static target and highway_popcnt_dispatch, which compiles them for every target. */
+
+HWY_BEFORE_NAMESPACE();
+namespace populationCount {
+namespace HWY_NAMESPACE {
+
+template <class D, class V>
+HWY_INLINE uint32_t PopcntSumOfLanes(D d, V input) {
+    using namespace hwy::HWY_NAMESPACE;
+    return GetLane(SumOfLanes(d, PopulationCount(input)));
+}
+
+template <class D, class V>
+HWY_INLINE uint32_t ExtractPopcnt32(D d, V v_t) {
+    using namespace hwy::HWY_NAMESPACE;
+    uint32_t t = 0; 
+
+    for(size_t i = 0; i < Lanes(d); i += 8) {
+        // unrolled for better performance, not portable for Systems with vector units smaller than 256-Bit
+        t += __builtin_popcount(ExtractLane(v_t, i + 0));
+        t += __builtin_popcount(ExtractLane(v_t, i + 1));
+        t += __builtin_popcount(ExtractLane(v_t, i + 2));
+        t += __builtin_popcount(ExtractLane(v_t, i + 3));
+        t += __builtin_popcount(ExtractLane(v_t, i + 4));
+        t += __builtin_popcount(ExtractLane(v_t, i + 5));
+        t += __builtin_popcount(ExtractLane(v_t, i + 6));
+        t += __builtin_popcount(ExtractLane(v_t, i + 7));
+    }
+
+    return t; 
+}
+
+template <class D, class V>
+HWY_INLINE uint32_t ExtractPopcnt64(D, V input) {
+    using namespace hwy::HWY_NAMESPACE;
+    const Repartition<uint64_t, D> d64; 
+    uint64_t t = 0; 
+    auto vec = BitCast(d64, input);
+
+    for(size_t i = 0; i < Lanes(d64); i += 4) {
+        t += __builtin_popcountl(ExtractLane(vec, i));
+        t += __builtin_popcountl(ExtractLane(vec, i + 1));
+        t += __builtin_popcountl(ExtractLane(vec, i + 2));
+        t += __builtin_popcountl(ExtractLane(vec, i + 3));
+    }
+
+    return (uint32_t) t; 
+}
+
+template <class D, class V>
+HWY_INLINE uint32_t StorePopcnt(D d, V v_t) {
+    using namespace hwy::HWY_NAMESPACE;
+    __attribute__((aligned(64))) uint32_t vec[Lanes(d)]; 
+    Store(v_t, d, vec);
+    uint32_t t = 0; 
+
+    for(size_t i = 0; i < Lanes(d); i++) {
+        t += __builtin_popcount(vec[i]);
+    }
+
+    return t; 
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace populationCount
+HWY_AFTER_NAMESPACE();
+
+#endif  // POPULATION_COUNT_INL_H_TARGET
@@ -0,0 +1,62 @@
+#include <assert.h>
+
+// Compiles this file once for every Highway target, HWY_ONCE is only true in the last pass
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "functionBench/populationCountDispatch.cpp"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+
+#include "populationCount-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace populationCount {
+namespace HWY_NAMESPACE {
+
+uint32_t PopulationCountArray(const uint32_t* const HWY_RESTRICT data, size_t count) {
+    using namespace hwy::HWY_NAMESPACE;
+
+    const ScalableTag<uint32_t> d;
+    const size_t N = Lanes(d);
+
+    // Load needs whole vectors at aligned addresses
+    assert(reinterpret_cast<uintptr_t>(data) % (N * sizeof(uint32_t)) == 0);
+
+    // Every vector is counted by the reduction of highway_popcnt_SumOfLanes
+    uint32_t result = 0;
+    size_t i = 0;
+    for (; i + N <= count; i += N) {
+        result += PopcntSumOfLanes(d, Load(d, data + i));
+    }
+
+    // The items that do not fill a vector
+    for (; i < count; i++) {
+        result += hwy::PopCount(data[i]);
+    }
+    return result;
+}
+
+const char * PopulationCountTarget() {
+    return hwy::TargetName(HWY_TARGET);
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace populationCount
+HWY_AFTER_NAMESPACE();
+
+
+#if HWY_ONCE
+#include "populationCountDispatch.hpp"
+
+namespace populationCount {
+HWY_EXPORT(PopulationCountArray);
+HWY_EXPORT(PopulationCountTarget);
+}  // namespace populationCount
+
+uint32_t highway_popcnt_dispatch(const uint32_t * data, size_t count) {
+    return HWY_DYNAMIC_DISPATCH(populationCount::PopulationCountArray)(data, count);
+}
+
+const char * highway_popcnt_dispatch_target() {
+    return HWY_DYNAMIC_DISPATCH(populationCount::PopulationCountTarget)();
+}
+#endif  // HWY_ONCE
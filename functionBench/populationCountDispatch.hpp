@@ -0,0 +1,28 @@
+#ifndef populationCountDispatch
+#define populationCountDispatch
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Counts the set bits of an array with google highway and dynamic dispatch. Every vector is
+ *  counted like highway_popcnt_SumOfLanes, compiled for the best target for the processor. 
+ *  PopulationCount is a single instruction where AVX512 VPOPCNTDQ is available.
+ *
+ * @param data
+ *          The array, aligned to 64 bytes
+ * @param count
+ *          The number of items, less than 2^27
+ *
+ * @return  The number of set bits
+*/
+uint32_t highway_popcnt_dispatch(const uint32_t * data, size_t count);
+
+/**
+ * Returns the name of the Highway target highway_popcnt_dispatch runs on this processor.
+ *
+ * @return  The name of the target
+*/
+const char * highway_popcnt_dispatch_target();
+
+#endif  // populationCountDispatch
@@ -1,11 +1,17 @@
 #include <iostream>
 #include <assert.h>
+#include <math.h>
 #include <pure_simd.hpp>
 #include <hwy/highway.h>
+#include <hwy/aligned_allocator.h>
 #include <hwy/print-inl.h> 
 
 #include "mandelbrotSettings.hpp"
 #include "mandelbrot.hpp"
+#include "mandelbrotInterior.hpp"
+#include "mandelbrotHighway-inl.h"
+#include "mandelbrotRegistry.hpp"
+#include "mandelbrotStats.hpp"
 #include "../utils/vecComplex.hpp"
 
 #if !defined(NEON) && !defined(SVE)
@@ -25,9 +31,19 @@
 #include <arm_sve.h>
 #endif 	// SVE include
 
-void mandelbrot_autoVec(float xBegin, float xEnd, 
+/* The _interiorCheck kernels skip the iteration for vectors whose lanes are all inside the main
+ * cardioid or the period-2 bulb.
+ *
+ * Every kernel is instantiated for the iteration caps of dispatchIterations and once with a
+ * runtime cap (fixedIterations == 0). The variants without a cap use MAX_ITERATIONS and BAILOUT. */
+
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_autoVec_kernel(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
-                      int width, int height, float * image) {
+                      int width, int height, float * image,
+                      int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     
     float xScale = (xEnd - xBegin) / width;
     float yScale = (yEnd - yBegin) / height;
@@ -39,6 +55,14 @@ void mandelbrot_autoVec(float xBegin, float xEnd,
 
             c_real = xBegin + i * xScale;
             c_imag = yBegin + j * yScale;
+
+            if constexpr (interiorCheck) {
+                if (insideCardioidOrBulb(c_real, c_imag)) {
+                    * image++ = 1.0f;
+                    continue;
+                }
+            }
+
             z_real = 0.0;
             z_imag = 0.0;
             
@@ -51,12 +75,12 @@ void mandelbrot_autoVec(float xBegin, float xEnd,
                 z_real = z_real_squared - z_imag_squared + c_real;
                 z_imag = temp + temp + c_imag;
 
-                if (z_imag_squared + z_real_squared > BAILOUT) {
+                if (z_imag_squared + z_real_squared > bailout) {
                     * image++ = 0.0f;
                     break;
                 }
                         
-                if (iteration > MAX_ITERATIONS) {
+                if (iteration > maxIterations) {
                     * image++ = 1.0f; 
                     break;
                 }
@@ -65,6 +89,53 @@ void mandelbrot_autoVec(float xBegin, float xEnd,
     }
 }
 
+void mandelbrot_autoVec(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image) {
+    mandelbrot_autoVec(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_autoVec(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_autoVec_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_autoVec_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image) {
+    mandelbrot_autoVec_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_autoVec_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_autoVec_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+// The registry uses the shared kernel signature with size_t dimensions
+static void mandelbrot_autoVec_registered(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_autoVec(xBegin, xEnd, yBegin, yEnd, (int) width, (int) height, image);
+}
+
+static void mandelbrot_autoVec_interiorCheck_registered(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_autoVec_interiorCheck(xBegin, xEnd, yBegin, yEnd, (int) width, (int) height, image);
+}
+REGISTER_MANDELBROT_KERNEL(autoVec, "autoVec", ISA_ANY, mandelbrot_autoVec_registered,
+                      mandelbrot_autoVec_interiorCheck_registered, 1);
+
 
 void mandelbrot_autoVec_complexClass(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
@@ -101,9 +172,13 @@ void mandelbrot_autoVec_complexClass(float xBegin, float xEnd,
     }
 }
 
-void mandelbrot_openMP(float xBegin, float xEnd, 
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_openMP_kernel(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
-                      int width, int height, float * image) {
+                      int width, int height, float * image,
+                      int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     
     float xScale = (xEnd - xBegin) / width;
     float yScale = (yEnd - yBegin) / height;
@@ -116,6 +191,14 @@ void mandelbrot_openMP(float xBegin, float xEnd,
 
             c_real = xBegin + i * xScale;
             c_imag = yBegin + j * yScale;
+
+            if constexpr (interiorCheck) {
+                if (insideCardioidOrBulb(c_real, c_imag)) {
+                    * image++ = 1.0f;
+                    continue;
+                }
+            }
+
             z_real = 0.0;
             z_imag = 0.0;
             
@@ -128,12 +211,12 @@ void mandelbrot_openMP(float xBegin, float xEnd,
                 z_real = z_real_squared - z_imag_squared + c_real;
                 z_imag = temp + temp + c_imag;
 
-                if (z_imag_squared + z_real_squared > BAILOUT) {
+                if (z_imag_squared + z_real_squared > bailout) {
                     * image++ = 0.0f;
                     break;
                 }
                         
-                if (iteration > MAX_ITERATIONS) {
+                if (iteration > maxIterations) {
                     * image++ = 1.0f; 
                     break;
                 }
@@ -142,27 +225,87 @@ void mandelbrot_openMP(float xBegin, float xEnd,
     }
 }
 
+void mandelbrot_openMP(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image) {
+    mandelbrot_openMP(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_openMP(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_openMP_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_openMP_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image) {
+    mandelbrot_openMP_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_openMP_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_openMP_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+static void mandelbrot_openMP_registered(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_openMP(xBegin, xEnd, yBegin, yEnd, (int) width, (int) height, image);
+}
+
+static void mandelbrot_openMP_interiorCheck_registered(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_openMP_interiorCheck(xBegin, xEnd, yBegin, yEnd, (int) width, (int) height, image);
+}
+REGISTER_MANDELBROT_KERNEL(openMP, "openMP", ISA_ANY, mandelbrot_openMP_registered,
+                      mandelbrot_openMP_interiorCheck_registered, 1);
+
 #ifndef NEON
 #ifndef SVE
-void mandelbrot_avx2(float xBegin, float xEnd, 
-                     float yBegin, float yEnd,
-                     size_t width, size_t height, float * image) {
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_avx2_kernel(float xBegin, float yBegin,
+                     float xScale, float yScale,
+                     size_t xOffset, size_t yOffset,
+                     size_t width, size_t height, float * image,
+                     int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     assert((width * height) % 8 == 0);
 
-    float xScale = (xEnd - xBegin) / width;
-    float yScale = (yEnd - yBegin) / height;
     __m256 xScaleVec = _mm256_set1_ps(xScale);
     __m256 xBeginVec = _mm256_set1_ps(xBegin);
-    __m256 bailoutVec = _mm256_set1_ps(BAILOUT);
+    __m256 bailoutVec = _mm256_set1_ps(bailout);
     __m256 oneVec = _mm256_set1_ps(1);
     __m256 zeroVec = _mm256_setzero_ps();
 
+    MANDELBROT_STATS_BEGIN(8);
     for (size_t j = 0; j < height; j++) {
-        __m256 c_imag = _mm256_set1_ps (yBegin + (j * yScale));
+        __m256 c_imag = _mm256_set1_ps (yBegin + ((yOffset + j) * yScale));
         for (size_t i = 0; i < width; i += 8) {
-            __m256 c_real = _mm256_set_ps(8 + i, 7 + i, 6 + i, 5 + i, 4 + i, 3 + i, 2 + i, 1 + i);
+            size_t x = xOffset + i;
+            __m256 c_real = _mm256_set_ps(8 + x, 7 + x, 6 + x, 5 + x, 4 + x, 3 + x, 2 + x, 1 + x);
             c_real = _mm256_fmadd_ps(c_real, xScaleVec, xBeginVec);
 
+            __m256 inside = _mm256_setzero_ps();
+            if constexpr (interiorCheck) {
+                inside = insideCardioidOrBulb_avx2(c_real, c_imag);
+                if (_mm256_movemask_ps(inside) == 0xFF) {
+                    _mm256_store_ps(&image[(j * width) + i], oneVec);
+                    continue;
+                }
+            }
+
             __m256 z_real = _mm256_setzero_ps();
             __m256 z_imag = _mm256_setzero_ps();
 
@@ -180,8 +323,15 @@ void mandelbrot_avx2(float xBegin, float xEnd,
                 __m256 norm = _mm256_add_ps(z_real_squared, z_imag_squared);
 
                 __m256 mask = _mm256_cmp_ps(norm, bailoutVec, _CMP_LT_OQ);
+                __m256 active = mask;
+                if constexpr (interiorCheck) {
+                    active = _mm256_andnot_ps(inside, mask);
+                    mask = _mm256_or_ps(mask, inside);
+                }
+
+                MANDELBROT_STATS_ITERATION(_mm_popcnt_u32(_mm256_movemask_ps(active)));
 
-                if (_mm256_movemask_ps(mask) == 0 || iteration > MAX_ITERATIONS) {
+                if (_mm256_movemask_ps(active) == 0 || iteration > maxIterations) {
                     __m256 result = _mm256_blendv_ps(zeroVec, oneVec, mask);
                     _mm256_store_ps(&image[(j * width) + i], result);
                     break;
@@ -190,62 +340,330 @@ void mandelbrot_avx2(float xBegin, float xEnd,
         }
     }
 }
+
+void mandelbrot_avx2(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image) {
+    mandelbrot_avx2(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_avx2(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_avx2_kernel<false, decltype(fixedIterations)::value>(xBegin, yBegin, xScale, yScale, 0, 0,
+                      width, height, image, maxIterations, bailout);
+    });
+}
+
+void mandelbrot_avx2_block(float xBegin, float yBegin,
+                     float xScale, float yScale,
+                     size_t xOffset, size_t yOffset,
+                     size_t width, size_t height, float * image) {
+    dispatchIterations(MAX_ITERATIONS, [&](auto fixedIterations) {
+        mandelbrot_avx2_kernel<false, decltype(fixedIterations)::value>(xBegin, yBegin, xScale, yScale, xOffset, yOffset,
+                      width, height, image, MAX_ITERATIONS, BAILOUT);
+    });
+}
+
+void mandelbrot_avx2_interiorCheck(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image) {
+    mandelbrot_avx2_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_avx2_interiorCheck(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_avx2_kernel<true, decltype(fixedIterations)::value>(xBegin, yBegin, xScale, yScale, 0, 0,
+                      width, height, image, maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(avx2, "avx2", ISA_AVX2, mandelbrot_avx2, mandelbrot_avx2_interiorCheck, 8,
+                      mandelbrot_avx2_block);
+
+void mandelbrot_avx2_refill(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image) {
+    mandelbrot_avx2_refill(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_avx2_refill(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    const size_t N = 8;
+    const size_t pixels = width * height;
+    assert(pixels % N == 0);
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    __m256 bailoutVec = _mm256_set1_ps(bailout);
+    __m256i maxIterationsVec = _mm256_set1_epi32(maxIterations);
+    __m256i oneVec = _mm256_set1_epi32(1);
+
+    // Pixel currently computed by each lane, the constants are kept in memory to refill single lanes.
+    // c_real is rounded once like the fused multiply-add of mandelbrot_avx2, so both render the same pixels
+    size_t pixel[N];
+    __attribute__((aligned(32))) float c_real_arr[N];
+    __attribute__((aligned(32))) float c_imag_arr[N];
+
+    size_t next = 0;
+    size_t nextI = 0;
+    size_t nextJ = 0;
+    for (size_t lane = 0; lane < N; lane++) {
+        pixel[lane] = next++;
+        c_real_arr[lane] = fmaf(nextI + 1, xScale, xBegin);
+        c_imag_arr[lane] = yBegin + (nextJ * yScale);
+        if (++nextI == width) {
+            nextI = 0;
+            nextJ++;
+        }
+    }
+    int activeLanes = 0xFF;
+
+    __m256 c_real = _mm256_load_ps(c_real_arr);
+    __m256 c_imag = _mm256_load_ps(c_imag_arr);
+    __m256 z_real = _mm256_setzero_ps();
+    __m256 z_imag = _mm256_setzero_ps();
+    __m256i iteration = _mm256_setzero_si256();
+
+    MANDELBROT_STATS_BEGIN(N);
+    while (activeLanes) {
+        iteration = _mm256_add_epi32(iteration, oneVec);
+
+        __m256 z_real_squared = _mm256_mul_ps(z_real, z_real);
+        __m256 z_imag_squared = _mm256_mul_ps(z_imag, z_imag);
+        __m256 temp = _mm256_mul_ps(z_real, z_imag);
+
+        z_real = _mm256_add_ps(_mm256_sub_ps(z_real_squared, z_imag_squared), c_real);
+        z_imag = _mm256_add_ps(_mm256_add_ps(temp, temp), c_imag);
+
+        __m256 norm = _mm256_add_ps(z_real_squared, z_imag_squared);
+
+        __m256 mask = _mm256_cmp_ps(norm, bailoutVec, _CMP_LT_OQ);
+        __m256 expired = _mm256_castsi256_ps(_mm256_cmpgt_epi32(iteration, maxIterationsVec));
+
+        /* lanes are done once they escaped or ran out of iterations */
+        __m256 done = _mm256_or_ps(_mm256_cmp_ps(norm, bailoutVec, _CMP_NLT_UQ), expired);
+        int doneLanes = _mm256_movemask_ps(done) & activeLanes;
+
+        MANDELBROT_STATS_ITERATION(_mm_popcnt_u32(_mm256_movemask_ps(mask) & activeLanes));
+
+        if (doneLanes != 0) {
+            int insideLanes = _mm256_movemask_ps(mask);
+
+            for (int lanes = doneLanes; lanes != 0; lanes &= lanes - 1) {
+                int lane = __builtin_ctz(lanes);
+                image[pixel[lane]] = (insideLanes & (1 << lane)) ? 1.0f : 0.0f;
+
+                if (next < pixels) {
+                    pixel[lane] = next++;
+                    c_real_arr[lane] = fmaf(nextI + 1, xScale, xBegin);
+                    c_imag_arr[lane] = yBegin + (nextJ * yScale);
+                    if (++nextI == width) {
+                        nextI = 0;
+                        nextJ++;
+                    }
+                } else {
+                    activeLanes &= ~(1 << lane);
+                }
+            }
+
+            // Restart the refilled lanes, idle lanes keep iterating on their last pixel
+            c_real = _mm256_load_ps(c_real_arr);
+            c_imag = _mm256_load_ps(c_imag_arr);
+            z_real = _mm256_andnot_ps(done, z_real);
+            z_imag = _mm256_andnot_ps(done, z_imag);
+            iteration = _mm256_andnot_si256(_mm256_castps_si256(done), iteration);
+        }
+    }
+}
 #endif
 #endif
 
 HWY_BEFORE_NAMESPACE();
-HWY_ATTR void mandelbrot_highway(float xBegin, float xEnd, 
+HWY_ATTR void mandelbrot_highway(float xBegin, float xEnd,
                       float yBegin, float yEnd,
                       size_t width, size_t height,
                       float* const HWY_RESTRICT image) {
-    using namespace hwy; 
+    mandelbrot_highway(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+HWY_ATTR void mandelbrot_highway(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout) {
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrotTargets::HWY_NAMESPACE::MandelbrotHighwayKernel<false, decltype(fixedIterations)::value>(xBegin, yBegin, xScale, yScale, 0, 0,
+                      width, height, image, maxIterations, bailout);
+    });
+}
+
+HWY_ATTR void mandelbrot_highway_block(float xBegin, float yBegin,
+                      float xScale, float yScale,
+                      size_t xOffset, size_t yOffset,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image) {
+    dispatchIterations(MAX_ITERATIONS, [&](auto fixedIterations) {
+        mandelbrotTargets::HWY_NAMESPACE::MandelbrotHighwayKernel<false, decltype(fixedIterations)::value>(xBegin, yBegin, xScale, yScale, xOffset, yOffset,
+                      width, height, image, MAX_ITERATIONS, BAILOUT);
+    });
+}
+
+HWY_ATTR void mandelbrot_highway_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image) {
+    mandelbrot_highway_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+HWY_ATTR void mandelbrot_highway_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout) {
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrotTargets::HWY_NAMESPACE::MandelbrotHighwayKernel<true, decltype(fixedIterations)::value>(xBegin, yBegin, xScale, yScale, 0, 0,
+                      width, height, image, maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(highway, "highway", ISA_ANY, mandelbrot_highway, mandelbrot_highway_interiorCheck,
+                      HWY_LANES(float), mandelbrot_highway_block);
+
+HWY_ATTR void mandelbrot_highway_refill(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image) {
+    mandelbrot_highway_refill(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+HWY_ATTR void mandelbrot_highway_refill(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout) {
+    using namespace hwy;
     using namespace HWY_NAMESPACE;
 
     const ScalableTag<float> d;
+    const RebindToSigned<decltype(d)> di;
     const size_t N = Lanes(d);
-    using V = decltype(Zero(d));
-    
-    assert((width * height) % N == 0); // Ensure that vector lanes fit
+    const size_t pixels = width * height;
+
+    assert(pixels % N == 0); // Ensure that vector lanes fit
 
     float xScale = (xEnd - xBegin) / width;
     float yScale = (yEnd - yBegin) / height;
 
-    auto xScaleVec = Set(d, xScale);
-    auto xBeginVec = Set(d, xBegin); 
-    auto bailoutVec = Set(d, BAILOUT);
+    auto bailoutVec = Set(d, bailout);
+    auto maxIterationsVec = Set(di, maxIterations);
+    auto oneVec = Set(di, 1);
+
+    // Pixel currently computed by each lane (pixels marks an idle lane),
+    // the constants are kept in memory to refill single lanes.
+    // c_real is rounded once like MulAdd of mandelbrot_highway, so both render the same pixels
+    AlignedFreeUniquePtr<size_t []> pixel = AllocateAligned<size_t>(N);
+    AlignedFreeUniquePtr<float []> c_real_arr = AllocateAligned<float>(N);
+    AlignedFreeUniquePtr<float []> c_imag_arr = AllocateAligned<float>(N);
+    AlignedFreeUniquePtr<int32_t []> done_arr = AllocateAligned<int32_t>(N);
+    AlignedFreeUniquePtr<int32_t []> inside_arr = AllocateAligned<int32_t>(N);
+
+    size_t next = 0;
+    size_t nextI = 0;
+    size_t nextJ = 0;
+    for (size_t lane = 0; lane < N; lane++) {
+        pixel[lane] = next++;
+        c_real_arr[lane] = fmaf(nextI, xScale, xBegin);
+        c_imag_arr[lane] = yBegin + (nextJ * yScale);
+        if (++nextI == width) {
+            nextI = 0;
+            nextJ++;
+        }
+    }
+    size_t activeLanes = N;
+
+    auto c_real = Load(d, c_real_arr.get());
+    auto c_imag = Load(d, c_imag_arr.get());
+    auto z_real = Zero(d);
+    auto z_imag = Zero(d);
+    auto iteration = Zero(di);
+
+#ifdef MANDELBROT_STATS
+    // Idle lanes keep iterating on their last pixel, they must not count as useful
+    AlignedFreeUniquePtr<int32_t []> busy_arr = AllocateAligned<int32_t>(N);
+    for (size_t lane = 0; lane < N; lane++) {
+        busy_arr[lane] = 1;
+    }
+    auto busy = RebindMask(d, Ne(Load(di, busy_arr.get()), Zero(di)));
+#endif
+
+    MANDELBROT_STATS_BEGIN(N);
+    while (activeLanes) {
+        iteration = Add(iteration, oneVec);
 
-    for (size_t j = 0; j < height; j++) {
-            auto c_imag = Set(d, yBegin + (j * yScale));
-        for (size_t i = 0; i < width; i += N) {
-            auto c_real = Iota(d, i);
-            c_real = MulAdd(c_real, xScaleVec, xBeginVec);
+        auto z_real_squared = Mul(z_real, z_real);
+        auto z_imag_squared = Mul(z_imag, z_imag);
+        auto temp = Mul(z_real, z_imag);
 
-            V z_real = Zero(d);
-            V z_imag = Zero(d);
+        z_real = Add(Sub(z_real_squared, z_imag_squared), c_real);
+        z_imag = Add(Add(temp, temp), c_imag);
 
-            int iteration = 0; 
-            while(1) {
-                iteration++;
+        /* lanes are done once they escaped or ran out of iterations */
+        auto norm = Add(z_real_squared, z_imag_squared);
+        auto mask = Lt(norm, bailoutVec);
+        auto done = Or(Not(mask), RebindMask(d, Gt(iteration, maxIterationsVec)));
 
-                auto z_real_squared = Mul(z_real, z_real); 
-                auto z_imag_squared = Mul(z_imag, z_imag);
-                auto temp = Mul(z_real, z_imag);
-                
-                z_real = Add(Sub(z_real_squared, z_imag_squared), c_real);
-                z_imag = Add(Add(temp, temp), c_imag); 
+        MANDELBROT_STATS_ITERATION(CountTrue(d, And(mask, busy)));
 
-                /* masking of bailout values */
-                auto norm = Add(z_real_squared, z_imag_squared);
-                auto mask = Lt(norm, bailoutVec);
+        if (!AllFalse(d, done)) {
+            Store(VecFromMask(di, RebindMask(di, done)), di, done_arr.get());
+            Store(VecFromMask(di, RebindMask(di, mask)), di, inside_arr.get());
 
-                if (iteration > MAX_ITERATIONS || AllFalse(d, mask)) {
-                    auto oneVec = Set(d, 1);
-                    auto result = IfThenElseZero(mask, oneVec);
- 
-                    Store(result, d, &image[(j * width) + i]);
-                    break;
+            for (size_t lane = 0; lane < N; lane++) {
+                if (done_arr[lane] == 0 || pixel[lane] == pixels) {
+                    continue;
+                }
+                image[pixel[lane]] = inside_arr[lane] ? 1.0f : 0.0f;
+
+                if (next < pixels) {
+                    pixel[lane] = next++;
+                    c_real_arr[lane] = fmaf(nextI, xScale, xBegin);
+                    c_imag_arr[lane] = yBegin + (nextJ * yScale);
+                    if (++nextI == width) {
+                        nextI = 0;
+                        nextJ++;
+                    }
+                } else {
+                    pixel[lane] = pixels;
+                    activeLanes--;
+#ifdef MANDELBROT_STATS
+                    busy_arr[lane] = 0;
+#endif
                 }
             }
+
+            // Restart the refilled lanes, idle lanes keep iterating on their last pixel
+            c_real = Load(d, c_real_arr.get());
+            c_imag = Load(d, c_imag_arr.get());
+#ifdef MANDELBROT_STATS
+            busy = RebindMask(d, Ne(Load(di, busy_arr.get()), Zero(di)));
+#endif
+            z_real = IfThenZeroElse(done, z_real);
+            z_imag = IfThenZeroElse(done, z_imag);
+            iteration = IfThenZeroElse(RebindMask(di, done), iteration);
         }
     }
 }
@@ -254,14 +672,19 @@ HWY_AFTER_NAMESPACE();
 
 #ifndef NEON
 #ifndef SVE
-void mandelbrot_vc(float xBegin, float xEnd, 
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_vc_kernel(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
-                      size_t width, size_t height, float * image) {
+                      size_t width, size_t height, float * image,
+                      int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     using namespace Vc; 
     assert((width * height) % float_v::Size == 0); // Ensure that vector lanes fit
     float xScale = (xEnd - xBegin) / width;
     float yScale = (yEnd - yBegin) / height;
 
+    MANDELBROT_STATS_BEGIN(float_v::Size);
     for (size_t j = 0; j < height; j++) {
         float_v c_imag = yBegin + j * yScale;
         uint_v x = uint_v::IndexesFromZero();
@@ -269,6 +692,19 @@ void mandelbrot_vc(float xBegin, float xEnd,
             float_v c_real = xBegin + simd_cast<float_v>(x) * xScale;
             x += (int) float_v::Size;
 
+            float_m inside(false);
+            if constexpr (interiorCheck) {
+                float_v cardioid_real = c_real - 0.25f;
+                float_v q = cardioid_real * cardioid_real + c_imag * c_imag;
+                float_v bulb_real = c_real + 1.0f;
+                inside = (q * (q + cardioid_real) <= 0.25f * c_imag * c_imag)
+                       | (bulb_real * bulb_real + c_imag * c_imag <= 0.0625f);
+                if (inside.isFull()) {
+                    float_v::One().store(&image[(j * width) + i], Vc::Unaligned);
+                    continue;
+                }
+            }
+
             float_v z_real = float_v::Zero();
             float_v z_imag = float_v::Zero();
 
@@ -285,8 +721,16 @@ void mandelbrot_vc(float xBegin, float xEnd,
 
                 float_v norm = z_real_squared + z_imag_squared;
 
-                float_m mask = norm < BAILOUT;
-                if (mask.isEmpty() || iteration > MAX_ITERATIONS) {
+                float_m mask = norm < bailout;
+                float_m active = mask;
+                if constexpr (interiorCheck) {
+                    active = mask && !inside;
+                    mask |= inside;
+                }
+
+                MANDELBROT_STATS_ITERATION(active.count());
+
+                if (active.isEmpty() || iteration > maxIterations) {
                     float_v result = float_v::Zero();
                     ++result(mask);
                     result.store(&image[(j * width) + i], Vc::Unaligned);
@@ -296,13 +740,50 @@ void mandelbrot_vc(float xBegin, float xEnd,
         }
     }
 }
+
+void mandelbrot_vc(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_vc(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_vc(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_vc_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_vc_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_vc_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_vc_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_vc_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(vc, "vc", ISA_ANY, mandelbrot_vc, mandelbrot_vc_interiorCheck, Vc::float_v::Size);
 #endif
 #endif
 
 #ifndef SVE
-void mandelbrot_libsimdpp(float xBegin, float xEnd, 
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_libsimdpp_kernel(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
-                      size_t width, size_t height, float * image) {
+                      size_t width, size_t height, float * image,
+                      int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     using namespace simdpp;
     const size_t N = SIMDPP_FAST_FLOAT32_SIZE; 
     assert((width * height) % N == 0); 
@@ -311,10 +792,11 @@ void mandelbrot_libsimdpp(float xBegin, float xEnd,
 
     float32<N> xScaleVec = splat(xScale);
     float32<N> xBeginVec = splat(xBegin);
-    float32<N> bailoutVec = splat(BAILOUT);
+    float32<N> bailoutVec = splat(bailout);
     float32<N> zeroVec = splat(0);
     float32<N> oneVec = splat(1);
  
+    MANDELBROT_STATS_BEGIN(N);
     for (size_t j = 0; j < height; j++) {
         float32<N> c_imag = splat(yBegin + (j * yScale)); 
         
@@ -329,6 +811,20 @@ void mandelbrot_libsimdpp(float xBegin, float xEnd,
 
             c_real = fmadd(c_real, xScaleVec, xBeginVec);
 
+            mask_float32<N> inside = cmp_lt(zeroVec, zeroVec);
+            if constexpr (interiorCheck) {
+                float32<N> c_imag_squared = mul(c_imag, c_imag);
+                float32<N> cardioid_real = sub(c_real, splat(0.25f));
+                float32<N> q = fmadd(cardioid_real, cardioid_real, c_imag_squared);
+                float32<N> bulb_real = add(c_real, oneVec);
+                inside = bit_or(cmp_le(mul(q, add(q, cardioid_real)), mul(splat(0.25f), c_imag_squared)),
+                                cmp_le(fmadd(bulb_real, bulb_real, c_imag_squared), splat(0.0625f)));
+                if (reduce_min(blend(oneVec, zeroVec, inside)) == 1.0f) {
+                    store(image + i + j*width, oneVec);
+                    continue;
+                }
+            }
+
             float32<N> z_real = splat(0);
             float32<N> z_imag = splat(0); 
 
@@ -345,9 +841,16 @@ void mandelbrot_libsimdpp(float xBegin, float xEnd,
 
                 float32<N> norm = add(z_real_squared, z_imag_squared);
                 mask_float32<N> mask = cmp_lt(norm, bailoutVec);
+                float32<N> active = blend(oneVec, zeroVec, mask);
+                if constexpr (interiorCheck) {
+                    active = blend(zeroVec, active, inside);
+                    mask = bit_or(mask, inside);
+                }
                 float32<N> result = blend(oneVec, zeroVec, mask);
-                
-                if (!test_bits_any(result) || iteration > MAX_ITERATIONS) {
+
+                MANDELBROT_STATS_ITERATION((uint64_t) reduce_add(active));
+
+                if (!test_bits_any(active) || iteration > maxIterations) {
                     store(image + i + j*width, result);
                     break; 
                 }
@@ -355,11 +858,49 @@ void mandelbrot_libsimdpp(float xBegin, float xEnd,
         }
     }
 }
-#endif
 
-void mandelbrot_pure_simd(float xBegin, float xEnd, 
+void mandelbrot_libsimdpp(float xBegin, float xEnd,
                       float yBegin, float yEnd,
                       size_t width, size_t height, float * image) {
+    mandelbrot_libsimdpp(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_libsimdpp(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_libsimdpp_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_libsimdpp_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_libsimdpp_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_libsimdpp_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_libsimdpp_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(libsimdpp, "libsimdpp", ISA_ANY, mandelbrot_libsimdpp, mandelbrot_libsimdpp_interiorCheck,
+                      SIMDPP_FAST_FLOAT32_SIZE);
+#endif
+
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_pure_simd_kernel(float xBegin, float xEnd, 
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     using namespace pure_simd;
     const size_t VECTOR_SIZE = 8;   // Defines how many times the code will be unrolled
     using TargetVec = vector<float, VECTOR_SIZE>;
@@ -371,6 +912,7 @@ void mandelbrot_pure_simd(float xBegin, float xEnd,
     auto xScaleVec = scalar<TargetVec>(xScale);
     auto xBeginVec = scalar<TargetVec>(xBegin);
 
+    MANDELBROT_STATS_BEGIN(VECTOR_SIZE);
     for (size_t j = 0; j < height; j++) {
         auto c_imag = scalar<TargetVec>(yBegin + (j * yScale));
 
@@ -378,6 +920,21 @@ void mandelbrot_pure_simd(float xBegin, float xEnd,
             auto c_real = iota<TargetVec, size_t>(i, 1.0f);
             c_real = (c_real * xScaleVec) + xBeginVec;
 
+            bool inside[VECTOR_SIZE] = {false};
+            if constexpr (interiorCheck) {
+                bool allInside = true;
+                for (size_t x = 0; x < VECTOR_SIZE; x++) {
+                    inside[x] = insideCardioidOrBulb(c_real[x], c_imag[x]);
+                    allInside &= inside[x];
+                }
+                if (allInside) {
+                    for (size_t x = 0; x < VECTOR_SIZE; x++) {
+                        image[(j * width) + i + x] = 1;
+                    }
+                    continue;
+                }
+            }
+
             auto z_real = scalar<TargetVec>(0.0f);
             auto z_imag = scalar<TargetVec>(0.0f);
 
@@ -393,19 +950,27 @@ void mandelbrot_pure_simd(float xBegin, float xEnd,
                 z_imag = (temp + temp) - c_imag; 
 
                 auto norm = z_real_squared + z_imag_squared;
-                auto mask = norm < scalar<TargetVec>((float) BAILOUT);
+                auto mask = norm < scalar<TargetVec>(bailout);
+
+#ifdef MANDELBROT_STATS
+                uint64_t usefulLanes = 0;
+                for (size_t x = 0; x < VECTOR_SIZE; x++) {
+                    usefulLanes += (mask[x] == 1 && !inside[x]);
+                }
+                MANDELBROT_STATS_ITERATION(usefulLanes);
+#endif
 
                 bool allFalse = true;
                 for (size_t x = 0; x < VECTOR_SIZE; x++) {
-                    if (mask[x] == 1) {
+                    if (mask[x] == 1 && !inside[x]) {
                         allFalse = false;
                         break; 
                     }
                 }
 
-                if (allFalse || iteration > MAX_ITERATIONS) {
+                if (allFalse || iteration > maxIterations) {
                     for (size_t x = 0; x < VECTOR_SIZE; x++) {
-                        if (mask[x] == 0) {
+                        if (mask[x] == 0 && !inside[x]) {
                             image[(j * width) + i + x] = 0;
                         } else {
                             image[(j * width) + i + x] = 1;
@@ -418,12 +983,52 @@ void mandelbrot_pure_simd(float xBegin, float xEnd,
     }
 }
 
+void mandelbrot_pure_simd(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_pure_simd(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_pure_simd(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_pure_simd_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_pure_simd_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_pure_simd_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_pure_simd_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_pure_simd_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(pure_simd, "pure_simd", ISA_ANY, mandelbrot_pure_simd, mandelbrot_pure_simd_interiorCheck, 8);
+
 #ifndef NEON
 #ifndef SVE
-#ifdef AVX512
-void mandelbrot_avx512(float xBegin, float xEnd, 
+/* The AVX512 kernels are compiled in every x86 build, mandelbrot_intrinsics_dispatch only calls them
+ * on processors that support AVX512 */
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_avx512_kernel(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
-                      size_t width, size_t height, float * image) {
+                      size_t width, size_t height, float * image,
+                      int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     assert((width * height) % 16 == 0);
     float xScale = (xEnd - xBegin) / width;
     float yScale = (yEnd - yBegin) / height;
@@ -431,10 +1036,11 @@ void mandelbrot_avx512(float xBegin, float xEnd,
     
     __m512 xScaleVec  = _mm512_set1_ps(xScale);
     __m512 xBeginVec = _mm512_set1_ps(xBegin);
-    __m512 bailoutVec = _mm512_set1_ps(BAILOUT);
+    __m512 bailoutVec = _mm512_set1_ps(bailout);
     __m512 oneVec = _mm512_set1_ps(1);
     __m512 zeroVec = _mm512_setzero_ps();
 
+    MANDELBROT_STATS_BEGIN(16);
     for (size_t j = 0; j < height; j++) {
     	__m512 c_imag = _mm512_set1_ps(yBegin + (j * yScale));
 	
@@ -442,6 +1048,15 @@ void mandelbrot_avx512(float xBegin, float xEnd,
             __m512 c_real = _mm512_set_ps(16+i, 15+i, 14+i, 13+i, 12+i, 11+i, 10+i, 9+i,
                 8 + i, 7 + i, 6 + i, 5 + i, 4 + i, 3 + i, 2 + i, 1 + i);
             c_real = _mm512_fmadd_ps(c_real, xScaleVec, xBeginVec);
+
+            __mmask16 inside = 0;
+            if constexpr (interiorCheck) {
+                inside = insideCardioidOrBulb_avx512(c_real, c_imag);
+                if (inside == 0xFFFF) {
+                    _mm512_store_ps(&image[(j * width) + i], _mm512_mask_blend_ps(inside, zeroVec, oneVec));
+                    continue;
+                }
+            }
         
             __m512 z_real = _mm512_setzero_ps();
             __m512 z_imag = _mm512_setzero_ps();
@@ -460,24 +1075,68 @@ void mandelbrot_avx512(float xBegin, float xEnd,
                 __m512 norm = _mm512_add_ps(z_real_squared, z_imag_squared);
 
                 __mmask16 mask = _mm512_cmp_ps_mask(norm, bailoutVec, _CMP_LT_OQ);
+                __mmask16 active = mask;
+                if constexpr (interiorCheck) {
+                    active = mask & ~inside;
+                    mask |= inside;
+                }
 
-                if ((int) mask  == 0 || iteration > MAX_ITERATIONS) {
-                    _mm512_store_ps(&image[(j * width) + i], _mm512_mask_blend_ps(mask, oneVec, zeroVec));
+                MANDELBROT_STATS_ITERATION(_mm_popcnt_u32(active));
+
+                if ((int) active == 0 || iteration > maxIterations) {
+                    _mm512_store_ps(&image[(j * width) + i], _mm512_mask_blend_ps(mask, zeroVec, oneVec));
                 break;
                 }
             }
         }
     }  
 }
-#endif // AVX512
+
+void mandelbrot_avx512(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_avx512(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_avx512(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_avx512_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_avx512_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_avx512_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_avx512_interiorCheck(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_avx512_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(avx512, "avx512", ISA_AVX512, mandelbrot_avx512, mandelbrot_avx512_interiorCheck, 16);
+#pragma GCC pop_options
 #endif // SVE
 #endif // NEON
 
 
 #ifdef NEON
-void mandelbrot_neon(float xBegin, float xEnd,
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_neon_kernel(float xBegin, float xEnd,
                      float yBegin, float yEnd,
-                     size_t width, size_t height, float * image) {
+                     size_t width, size_t height, float * image,
+                     int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
     const size_t LANE_SIZE = 4;
     assert((width * height) % LANE_SIZE == 0);
     float xScale = (xEnd - xBegin) / width;
@@ -485,9 +1144,10 @@ void mandelbrot_neon(float xBegin, float xEnd,
 
     float32x4_t xScaleVec = vdupq_n_f32(xScale);
     float32x4_t xBeginVec = vdupq_n_f32(xBegin);
-    float32x4_t bailoutVec = vdupq_n_f32(BAILOUT);
+    float32x4_t bailoutVec = vdupq_n_f32(bailout);
     uint32x4_t oneVec = vdupq_n_u32(1);
 
+    MANDELBROT_STATS_BEGIN(4);
     for (size_t j = 0; j < height; j++) {
 	    float32x4_t c_imag = vdupq_n_f32(yBegin + (j* yScale));
         for (size_t i = 0; i < width; i += LANE_SIZE) {
@@ -495,6 +1155,20 @@ void mandelbrot_neon(float xBegin, float xEnd,
             float32x4_t c_real = vld1q_f32(c_real_arr);
 	        c_real = vaddq_f32(vmulq_f32(c_real, xScaleVec), xBeginVec);
 
+            uint32x4_t inside = vdupq_n_u32(0);
+            if constexpr (interiorCheck) {
+                float32x4_t c_imag_squared = vmulq_f32(c_imag, c_imag);
+                float32x4_t x = vsubq_f32(c_real, vdupq_n_f32(0.25f));
+                float32x4_t q = vfmaq_f32(c_imag_squared, x, x);
+                float32x4_t bulb_real = vaddq_f32(c_real, vdupq_n_f32(1.0f));
+                inside = vorrq_u32(vcleq_f32(vmulq_f32(q, vaddq_f32(q, x)), vmulq_f32(vdupq_n_f32(0.25f), c_imag_squared)),
+                                   vcleq_f32(vfmaq_f32(c_imag_squared, bulb_real, bulb_real), vdupq_n_f32(0.0625f)));
+                if (vminvq_u32(inside) != 0) {
+                    vst1q_f32(&image[j * width + i], vdupq_n_f32(1.0f));
+                    continue;
+                }
+            }
+
             float32x4_t z_real = vdupq_n_f32(0);
             float32x4_t z_imag = vdupq_n_f32(0);
 
@@ -511,14 +1185,21 @@ void mandelbrot_neon(float xBegin, float xEnd,
 
                 float32x4_t norm = vaddq_f32(z_real_squared, z_imag_squared);
 		        uint32x4_t mask = vcltq_f32(norm, bailoutVec);
+                uint32x4_t active = mask;
+                if constexpr (interiorCheck) {
+                    active = vbicq_u32(mask, inside);
+                    mask = vorrq_u32(mask, inside);
+                }
 
-                if (iteration > MAX_ITERATIONS) {
+                MANDELBROT_STATS_ITERATION(vaddvq_u32(vandq_u32(active, oneVec)));
+
+                if (iteration > maxIterations) {
                     float32x4_t result = vcvtq_f32_u32(vandq_u32(mask, oneVec));
                     vst1q_f32(&image[j * width + i], result);
                     break;
                 }
 
-                if (vaddvq_u32(vandq_u32(mask, oneVec)) == 0) {
+                if (vaddvq_u32(vandq_u32(active, oneVec)) == 0) {
                     float32x4_t result = vcvtq_f32_u32(vandq_u32(mask, oneVec));
                     vst1q_f32(&image[j * width + i], result);
                     break;
@@ -527,13 +1208,50 @@ void mandelbrot_neon(float xBegin, float xEnd,
         }
     }
 }
+
+void mandelbrot_neon(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image) {
+    mandelbrot_neon(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_neon(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_neon_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_neon_interiorCheck(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image) {
+    mandelbrot_neon_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_neon_interiorCheck(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_neon_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(neon, "neon", ISA_NEON, mandelbrot_neon, mandelbrot_neon_interiorCheck, 4);
 #endif
 
 
 #ifdef SVE
-void mandelbrot_sve(float xBegin, float xEnd,
+template <bool interiorCheck, int fixedIterations>
+static void mandelbrot_sve_kernel(float xBegin, float xEnd,
                      float yBegin, float yEnd,
-                     size_t width, size_t height, float * image) {
+                     size_t width, size_t height, float * image,
+                     int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
 	const uint64_t N = svcntw();
     assert((width * height) % N == 0);
     float xScale = (xEnd - xBegin) / width;
@@ -542,16 +1260,34 @@ void mandelbrot_sve(float xBegin, float xEnd,
 	svbool_t allTrue = svdup_b32(true);
 	svfloat32_t xScaleVec = svdup_f32(xScale);
 	svfloat32_t xBeginVec = svdup_f32(xBegin);
-	svfloat32_t bailoutVec = svdup_f32(BAILOUT);
+	svfloat32_t bailoutVec = svdup_f32(bailout);
 	svfloat32_t oneVec = svdup_f32(1);
 	svfloat32_t zeroVec = svdup_f32(0);
 
+	MANDELBROT_STATS_BEGIN(N);
 	for (size_t j = 0; j < height; j++) {
 		svfloat32_t c_imag = svdup_f32(yBegin + (j* yScale));	
 		for (size_t i = 0; i < width; i += N) {
 			svfloat32_t c_real = svcvt_f32_s32_x(svptrue_b32(), svindex_s32((int32_t) i+1, (int32_t) 1));
 			c_real = svadd_f32_x(allTrue, svmul_f32_m(allTrue, c_real, xScaleVec), xBeginVec); 
 
+			svbool_t inside = svpfalse_b();
+			if constexpr (interiorCheck) {
+				svfloat32_t c_imag_squared = svmul_f32_x(allTrue, c_imag, c_imag);
+				svfloat32_t x = svsub_f32_x(allTrue, c_real, svdup_f32(0.25f));
+				svfloat32_t q = svmad_f32_x(allTrue, x, x, c_imag_squared);
+				svfloat32_t bulb_real = svadd_f32_x(allTrue, c_real, oneVec);
+				svbool_t cardioid = svcmple_f32(allTrue, svmul_f32_x(allTrue, q, svadd_f32_x(allTrue, q, x)),
+				                                svmul_f32_x(allTrue, svdup_f32(0.25f), c_imag_squared));
+				svbool_t bulb = svcmple_f32(allTrue, svmad_f32_x(allTrue, bulb_real, bulb_real, c_imag_squared),
+				                            svdup_f32(0.0625f));
+				inside = svorr_b_z(allTrue, cardioid, bulb);
+				if (svcntp_b32(allTrue, inside) == N) {
+					svst1_f32(allTrue, &image[i + (j*width)], oneVec);
+					continue;
+				}
+			}
+
 			svfloat32_t z_imag = svdup_f32(0);
 			svfloat32_t z_real = svdup_f32(0);
 			
@@ -568,15 +1304,22 @@ void mandelbrot_sve(float xBegin, float xEnd,
 
 				svfloat32_t norm =  svadd_f32_x(allTrue, z_real_squared, z_imag_squared);
 				svbool_t mask = svcmplt_f32(allTrue, norm, bailoutVec);
+				svbool_t active = mask;
+				if constexpr (interiorCheck) {
+					active = svbic_b_z(allTrue, mask, inside);
+					mask = svorr_b_z(allTrue, mask, inside);
+				}
+
+				MANDELBROT_STATS_ITERATION(svcntp_b32(allTrue, active));
 
-				if (iteration > MAX_ITERATIONS) {
+				if (iteration > maxIterations || (interiorCheck && svcntp_b32(allTrue, active) == 0)) {
 					svst1_f32(mask, &image[i + (j*width)], oneVec);
 					svbool_t negMask = svbic_b_z(allTrue, allTrue, mask); 
 					svst1_f32(negMask, &image[i + (j*width)], zeroVec); 	
 					break;
 				}
 
-				if (svcntp_b32(allTrue, mask) == 0) {
+				if (svcntp_b32(allTrue, active) == 0) {
 					svst1_f32(allTrue, &image[i + (j*width)], zeroVec); 
 					break; 
 				}
@@ -584,4 +1327,37 @@ void mandelbrot_sve(float xBegin, float xEnd,
 		}
 	}
 }
+
+void mandelbrot_sve(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image) {
+    mandelbrot_sve(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_sve(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_sve_kernel<false, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+
+void mandelbrot_sve_interiorCheck(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image) {
+    mandelbrot_sve_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_sve_interiorCheck(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        mandelbrot_sve_kernel<true, decltype(fixedIterations)::value>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+    });
+}
+REGISTER_MANDELBROT_KERNEL(sve, "sve", ISA_SVE, mandelbrot_sve, mandelbrot_sve_interiorCheck, svcntw());
 #endif
@@ -3,8 +3,889 @@
 
 #include <hwy/highway.h>
 
+/* Every kernel with an _interiorCheck variant and the _refill kernels also have an overload taking
+ * the iteration cap and the bailout at runtime, the variants without them use MAX_ITERATIONS and
+ * BAILOUT. The caps
+ * listed in dispatchIterations (mandelbrotSettings.hpp) run specialized kernels with a constant
+ * loop bound. */
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions. 
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_autoVec(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_autoVec(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_autoVec_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_autoVec_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  using light weight functions for complex numbers. 
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_autoVec_complexClass(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, int * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions using openMP pragmas to support the auto vectorization. 
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_openMP(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions using openMP pragmas to support the auto vectorization. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_openMP(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions using openMP pragmas to support the auto vectorization. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_openMP_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions using openMP pragmas to support the auto vectorization. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_openMP_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, float * image,
+                      int maxIterations, float bailout);
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics. 
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_avx2(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_avx2(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout);
+
+
+/**
+ * Calculates a block of a larger image of the mandelbrot set, employing vectorization 
+ *  by using intrinsics. The pixel (x, y) of the larger image lies at 
+ *  xBegin + x * xScale, yBegin + y * yScale, so the block matches the same pixels
+ *  of mandelbrot_avx2 for the whole image exactly.
+ * 
+ * @param xBegin
+ *          The x value of the left boarder of the larger image
+ * @param yBegin
+ *          The y value of the top boarder of the larger image
+ * @param xScale
+ *          The width of a pixel
+ * @param yScale
+ *          The height of a pixel
+ * @param xOffset
+ *          The first column of the block in the larger image
+ * @param yOffset
+ *          The first row of the block in the larger image
+ * @param width 
+ *          The width of the block
+ * @param heigth
+ *          The height of the block 
+ * @param image
+ *          The immage array of the block
+ * 
+*/
+void mandelbrot_avx2_block(float xBegin, float yBegin,
+                     float xScale, float yScale,
+                     size_t xOffset, size_t yOffset,
+                     size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_avx2_interiorCheck(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_avx2_interiorCheck(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics. Lanes are retired as soon as 
+ *  their pixel escaped and refilled with the next pending pixel.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_avx2_refill(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics. Lanes are retired as soon as 
+ *  their pixel escaped and refilled with the next pending pixel.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_avx2_refill(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library. 
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+HWY_ATTR void mandelbrot_highway(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+HWY_ATTR void mandelbrot_highway(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates a block of a larger image of the mandelbrot set, employing vectorization 
+ *  by using the Highway library. The pixel (x, y) of the larger image lies at 
+ *  xBegin + x * xScale, yBegin + y * yScale, so the block matches the same pixels
+ *  of mandelbrot_highway for the whole image exactly.
+ * 
+ * @param xBegin
+ *          The x value of the left boarder of the larger image
+ * @param yBegin
+ *          The y value of the top boarder of the larger image
+ * @param xScale
+ *          The width of a pixel
+ * @param yScale
+ *          The height of a pixel
+ * @param xOffset
+ *          The first column of the block in the larger image
+ * @param yOffset
+ *          The first row of the block in the larger image
+ * @param width 
+ *          The width of the block
+ * @param heigth
+ *          The height of the block 
+ * @param image
+ *          The immage array of the block
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_block(float xBegin, float yBegin,
+                      float xScale, float yScale,
+                      size_t xOffset, size_t yOffset,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library. Lanes are retired as soon as 
+ *  their pixel escaped and refilled with the next pending pixel.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_refill(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library. Lanes are retired as soon as 
+ *  their pixel escaped and refilled with the next pending pixel.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_refill(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout);
+
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Vc library. 
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_vc(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Vc library. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_vc(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Vc library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_vc_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Vc library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_vc_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+#endif	// SVE
+#endif	// NEON
+
+
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the libsimdpp library. 
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_libsimdpp(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the libsimdpp library. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_libsimdpp(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+
+
 /**
- * Calculates the image of the mandelbrot set with the given dimensions. 
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the libsimdpp library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -24,14 +905,17 @@
  *          The immage array
  * 
 */
-void mandelbrot_autoVec(float realBeginning, float realEnd, 
+void mandelbrot_libsimdpp_interiorCheck(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
-                      int width, int height, float * image);
+                      size_t width, size_t height, float * image);
 
 
 /**
  * Calculates the image of the mandelbrot set with the given dimensions, 
- *  using light weight functions for complex numbers. 
+ *  employing vectorization by using the libsimdpp library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -45,19 +929,24 @@ void mandelbrot_autoVec(float realBeginning, float realEnd,
  *          The width of the image
  * @param heigth
  *          The height of the image 
- * @param maxIterations
- *          The maximum number of iterations per number tested
  * @param image
  *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
  * 
 */
-void mandelbrot_autoVec_complexClass(float realBeginning, float realEnd, 
+void mandelbrot_libsimdpp_interiorCheck(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
-                      int width, int height, int * image);
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+#endif
 
 
 /**
- * Calculates the image of the mandelbrot set with the given dimensions using openMP pragmas to support the auto vectorization. 
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the pure simd library. 
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -77,15 +966,15 @@ void mandelbrot_autoVec_complexClass(float realBeginning, float realEnd,
  *          The immage array
  * 
 */
-void mandelbrot_openMP(float realBeginning, float realEnd, 
+void mandelbrot_pure_simd(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
-                      int width, int height, float * image);
+                      size_t width, size_t height, float * image);
+
 
-#ifndef NEON
-#ifndef SVE
 /**
  * Calculates the image of the mandelbrot set with the given dimensions, 
- *  employing vectorization by using intrinsics. 
+ *  employing vectorization by using the pure simd library. 
+ *  The iteration cap and the bailout are given at runtime.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -99,22 +988,25 @@ void mandelbrot_openMP(float realBeginning, float realEnd,
  *          The width of the image
  * @param heigth
  *          The height of the image 
- * @param maxIterations
- *          The maximum number of iterations per number tested
  * @param image
  *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
  * 
 */
-void mandelbrot_avx2(float realBeginning, float realEnd, 
-                     float imagBeginning, float imagEnd,
-                     size_t width, size_t height, float * image);
-#endif	// SVE
-#endif	// NEON
+void mandelbrot_pure_simd(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
 
 
 /**
  * Calculates the image of the mandelbrot set with the given dimensions, 
- *  employing vectorization by using the Highway library. 
+ *  employing vectorization by using the pure simd library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -134,17 +1026,48 @@ void mandelbrot_avx2(float realBeginning, float realEnd,
  *          The immage array
  * 
 */
-HWY_ATTR void mandelbrot_highway(float realBeginning, float realEnd, 
+void mandelbrot_pure_simd_interiorCheck(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
-                      size_t width, size_t height,
-                      float* const HWY_RESTRICT image);
+                      size_t width, size_t height, float * image);
 
 
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the pure simd library. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_pure_simd_interiorCheck(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
 #ifndef NEON
 #ifndef SVE
 /**
  * Calculates the image of the mandelbrot set with the given dimensions, 
- *  employing vectorization by using the Vc library. 
+ *  employing vectorization by using AVX512. Available in every x86 build, the processor has to
+ *  support AVX512F.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -164,17 +1087,15 @@ HWY_ATTR void mandelbrot_highway(float realBeginning, float realEnd,
  *          The immage array
  * 
 */
-void mandelbrot_vc(float realBeginning, float realEnd, 
+void mandelbrot_avx512(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
                       size_t width, size_t height, float * image);
-#endif	// SVE
-#endif	// NEON
 
 
-#ifndef SVE
 /**
  * Calculates the image of the mandelbrot set with the given dimensions, 
- *  employing vectorization by using the libsimdpp library. 
+ *  employing vectorization by using AVX512. 
+ *  The iteration cap and the bailout are given at runtime.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -188,21 +1109,25 @@ void mandelbrot_vc(float realBeginning, float realEnd,
  *          The width of the image
  * @param heigth
  *          The height of the image 
- * @param maxIterations
- *          The maximum number of iterations per number tested
  * @param image
  *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
  * 
 */
-void mandelbrot_libsimdpp(float realBeginning, float realEnd, 
+void mandelbrot_avx512(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
-                      size_t width, size_t height, float * image);
-#endif
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
 
 
 /**
  * Calculates the image of the mandelbrot set with the given dimensions, 
- *  employing vectorization by using the pure simd library. 
+ *  employing vectorization by using AVX512. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -222,15 +1147,17 @@ void mandelbrot_libsimdpp(float realBeginning, float realEnd,
  *          The immage array
  * 
 */
-void mandelbrot_pure_simd(float realBeginning, float realEnd, 
+void mandelbrot_avx512_interiorCheck(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
                       size_t width, size_t height, float * image);
-#ifndef NEON
-#ifndef SVE
-#ifdef AVX512
+
+
 /**
  * Calculates the image of the mandelbrot set with the given dimensions, 
  *  employing vectorization by using AVX512. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
  * 
  * @param realBeginning
  *          The x value which sets the left boarder of the image
@@ -244,16 +1171,18 @@ void mandelbrot_pure_simd(float realBeginning, float realEnd,
  *          The width of the image
  * @param heigth
  *          The height of the image 
- * @param maxIterations
- *          The maximum number of iterations per number tested
  * @param image
  *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
  * 
 */
-void mandelbrot_avx512(float realBeginning, float realEnd, 
+void mandelbrot_avx512_interiorCheck(float realBeginning, float realEnd, 
                       float imagBeginning, float imagEnd,
-                      size_t width, size_t height, float * image);
-#endif  // AVX512
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
 #endif  // SVE
 #endif 	// NEON
 
@@ -284,6 +1213,99 @@ void mandelbrot_avx512(float realBeginning, float realEnd,
 void mandelbrot_neon(float realBeginning, float realEnd,
                       float imagBeginning, float imagEnd,
                       size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using neon extension. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_neon(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using neon extension. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_neon_interiorCheck(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using neon extension. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_neon_interiorCheck(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
 #endif 	// NEON Implementation
 
 #ifdef SVE 
@@ -312,5 +1334,98 @@ void mandelbrot_neon(float realBeginning, float realEnd,
 void mandelbrot_sve(float realBeginning, float realEnd,
                       float imagBeginning, float imagEnd,
                       size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using sve intrinsics. 
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_sve(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using sve intrinsics. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param image
+ *          The immage array
+ * 
+*/
+void mandelbrot_sve_interiorCheck(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using sve intrinsics. 
+ *  Pixels inside the main cardioid or the period-2 bulb are detected analytically
+ *  and skip the iteration.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_sve_interiorCheck(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
 #endif	// SVE
 #endif  // mandelbrot
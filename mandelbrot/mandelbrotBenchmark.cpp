@@ -5,7 +5,27 @@
 #include <simdpp/simd.h>
 #endif
 
+#include <cmath>
+#include <map>
+#include <string>
+#include <thread>
+
 #include "mandelbrot.hpp"
+#include "mandelbrotIterations.hpp"
+#include "mandelbrotPacked.hpp"
+#include "mandelbrotInterleaved.hpp"
+#include "mandelbrotDispatch.hpp"
+#include "mandelbrotDouble.hpp"
+#include "mandelbrotPerturbation.hpp"
+#include "mandelbrotPeriodicity.hpp"
+#include "mandelbrotThreaded.hpp"
+#include "mandelbrotSubdivision.hpp"
+#include "mandelbrotRegistry.hpp"
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotSmooth.hpp"
+#include "mandelbrotColor.hpp"
+#include "mandelbrotStats.hpp"
+#include "mandelbrotEscapeTime.hpp"
 #include "nsimdMandelbrot.hpp"
 #include "nsimdBaseMandelbrot.hpp"
 #include "simdeMandelbrot.hpp"
@@ -21,11 +41,37 @@ const static float xEnd = 0.5f;
 const static float yBegin = -1.5f; 
 const static float yEnd = 1.5f; 
 
+// The constant of the Julia set known as Douady's rabbit
+const static float juliaReal = -0.123f;
+const static float juliaImag = 0.745f;
+
+// Runs the periodicity benchmarks with the tolerances 1e-3, 1e-4, 1e-5 and 1e-6
+static void ToleranceArguments(benchmark::internal::Benchmark* b) {
+    b->DenseRange(3, 6);
+}
+
+// Runs the multibrot benchmarks with the powers 2 to 5
+static void PowerArguments(benchmark::internal::Benchmark* b) {
+    b->DenseRange(2, 5);
+}
+
+// Runs the interleaved benchmarks with 1, 2 and 4 vectors per loop
+static void InterleaveArguments(benchmark::internal::Benchmark* b) {
+    b->Arg(1)->Arg(2)->Arg(4);
+}
+
+// Runs the iteration cap benchmarks with the specialized caps and with the runtime cap next to them
+static void IterationArguments(benchmark::internal::Benchmark* b) {
+    for (int maxIterations : {100, 101, 256, 257, 1000, 1001}) {
+        b->Arg(maxIterations);
+    }
+}
+
 static void BM_Mandelbrot_Scalar(benchmark::State& state) {
-    float image[width * height]; 
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_scalar(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_scalar(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
     }
 }
 BENCHMARK(BM_Mandelbrot_Scalar)
@@ -39,10 +85,10 @@ BENCHMARK(BM_Mandelbrot_Scalar)
     });
 
 static void BM_Mandelbrot_Scalar_ComplexClass(benchmark::State& state) {
-    int image[width * height]; 
+    hwy::AlignedFreeUniquePtr<int []> image = hwy::AllocateAligned<int>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_scalar_complexClass(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_scalar_complexClass(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
     }
 }
 /*
@@ -58,10 +104,10 @@ BENCHMARK(BM_Mandelbrot_Scalar_ComplexClass)
 */
 
 static void BM_Mandelbrot_AutoVec(benchmark::State& state) {
-    float image[width * height]; 
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_autoVec(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_autoVec(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
     }
 }
 BENCHMARK(BM_Mandelbrot_AutoVec)
@@ -74,12 +120,29 @@ BENCHMARK(BM_Mandelbrot_AutoVec)
     return *(std::min_element(std::begin(v), std::end(v)));
     });
 
+static void BM_Mandelbrot_AutoVec_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_autoVec_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AutoVec_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
 
 static void BM_Mandelbrot_AutoVec_ComplexClass(benchmark::State& state) {
-    int image[width * height]; 
+    hwy::AlignedFreeUniquePtr<int []> image = hwy::AllocateAligned<int>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_autoVec_complexClass(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_autoVec_complexClass(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
     }
 }
 /*
@@ -95,10 +158,10 @@ BENCHMARK(BM_Mandelbrot_AutoVec_ComplexClass)
 */
 
 static void BM_Mandelbrot_OpenMP(benchmark::State& state) {
-    __attribute__((aligned(64))) float image[width * height]; 
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_openMP(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_openMP(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
     }
 }
 BENCHMARK(BM_Mandelbrot_OpenMP)
@@ -111,14 +174,31 @@ BENCHMARK(BM_Mandelbrot_OpenMP)
     return *(std::min_element(std::begin(v), std::end(v)));
     });
 
+static void BM_Mandelbrot_OpenMP_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_openMP_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_OpenMP_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
 #ifndef AVX512
 #ifndef NEON
 #ifndef SVE
 static void BM_Mandelbrot_AVX2(benchmark::State& state) {
-    __attribute__((aligned(32))) float image[width * height] = {0};
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_avx2(xBegin, xEnd, yBegin, yEnd, width, height, image); 
+        mandelbrot_avx2(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
     }
 }
 BENCHMARK(BM_Mandelbrot_AVX2)
@@ -130,19 +210,34 @@ BENCHMARK(BM_Mandelbrot_AVX2)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif	// SVE
-#endif 	// NEON
-#endif 	// AVX512
 
+static void BM_Mandelbrot_AVX2_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
-static void BM_Mandelbrot_Highway(benchmark::State& state) {
+    for (auto _ : state) {
+        mandelbrot_avx2_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX2_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX2_Periodicity(benchmark::State& state) {
     hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    float tolerance = std::pow(10.0f, -(float) state.range(0));
 
     for (auto _ : state) {
-        mandelbrot_highway(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+        mandelbrot_avx2_periodicity(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], tolerance);
     }
 }
-BENCHMARK(BM_Mandelbrot_Highway)
+BENCHMARK(BM_Mandelbrot_AVX2_Periodicity)
+    ->Apply(ToleranceArguments)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -152,18 +247,33 @@ BENCHMARK(BM_Mandelbrot_Highway)
     return *(std::min_element(std::begin(v), std::end(v)));
     });
 
+static void BM_Mandelbrot_AVX2_MaxIterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
-#ifndef AVX512
-#ifndef NEON
-#ifndef SVE
-static void BM_Mandelbrot_Vc(benchmark::State& state) {
-    float image[width * height];
+    for (auto _ : state) {
+        mandelbrot_avx2(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0), BAILOUT);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX2_MaxIterations)
+    ->Apply(IterationArguments)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX2_Interleaved(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_vc(xBegin, xEnd, yBegin, yEnd, width, height, image); 
+        mandelbrot_avx2_interleaved(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
     }
 }
-BENCHMARK(BM_Mandelbrot_Vc)
+BENCHMARK(BM_Mandelbrot_AVX2_Interleaved)
+    ->Apply(InterleaveArguments)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -172,25 +282,32 @@ BENCHMARK(BM_Mandelbrot_Vc)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif	// SVE
-#endif 	// NEON
-#endif 	// AVX512
 
+static void BM_Mandelbrot_AVX2_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
 
-#ifndef SVE
-static void BM_Mandelbrot_Libsimdpp(benchmark::State& state) {
-#ifndef AVX512
-    simdpp::aligned_allocator<float, 32> allocator;
-#else
-    simdpp::aligned_allocator<float, 64> allocator;
-#endif    
-    float * image = allocator.allocate(width * height); 
+    for (auto _ : state) {
+        mandelbrot_avx2_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX2_Iterations)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX2_Smooth(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_libsimdpp(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_avx2_smooth(xBegin, xEnd, yBegin, yEnd, width, height, &smooth[0]);
     }
 }
-BENCHMARK(BM_Mandelbrot_Libsimdpp)
+BENCHMARK(BM_Mandelbrot_AVX2_Smooth)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -199,17 +316,40 @@ BENCHMARK(BM_Mandelbrot_Libsimdpp)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif
 
+static void BM_Colorize_AVX2_Smooth(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgb = hwy::AllocateAligned<uint8_t>(3 * width * height);
+    mandelbrot_avx2_smooth(xBegin, xEnd, yBegin, yEnd, width, height, &smooth[0]);
 
-static void BM_Mandelbrot_Pure_Simd(benchmark::State& state) {
-    float image[width * height] = {0};
+    for (auto _ : state) {
+        colorize_avx2_smooth(&smooth[0], width * height, MAX_ITERATIONS + 1, &rgb[0]);
+    }
+    state.SetBytesProcessed(state.iterations() * width * height * (sizeof(float) + 3));
+}
+BENCHMARK(BM_Colorize_AVX2_Smooth)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Colorize_AVX2_Palette(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgb = hwy::AllocateAligned<uint8_t>(3 * width * height);
+    uint32_t palette[256];
+    createPolynomialPalette(palette, 256);
+    mandelbrot_avx2_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
 
     for (auto _ : state) {
-        mandelbrot_pure_simd(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        colorize_avx2_palette(&iterations[0], width * height, palette, 256, &rgb[0]);
     }
+    state.SetBytesProcessed(state.iterations() * width * height * (sizeof(uint32_t) + 3));
 }
-BENCHMARK(BM_Mandelbrot_Pure_Simd)
+BENCHMARK(BM_Colorize_AVX2_Palette)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -219,15 +359,14 @@ BENCHMARK(BM_Mandelbrot_Pure_Simd)
     return *(std::min_element(std::begin(v), std::end(v)));
     });
 
-#ifndef SVE
-static void BM_Mandelbrot_NSIMD(benchmark::State& state) {
-    __attribute__((aligned(64))) float image[width * height] = {0};
+static void BM_Julia_AVX2(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_nsimd(xBegin, xEnd, yBegin, yEnd, width, height, image); 
+        julia_avx2(-1.5f, 1.5f, -1.5f, 1.5f, width, height, &image[0], juliaReal, juliaImag);
     }
 }
-BENCHMARK(BM_Mandelbrot_NSIMD)
+BENCHMARK(BM_Julia_AVX2)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -236,18 +375,33 @@ BENCHMARK(BM_Mandelbrot_NSIMD)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif
 
+static void BM_BurningShip_AVX2(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
-#ifndef SVE
-static void BM_Mandelbrot_NSIMD_BASE(benchmark::State& state) {
-    __attribute__((aligned(64))) float image[width * height] = {0};
+    for (auto _ : state) {
+        burningShip_avx2(-2.0f, 1.5f, -2.0f, 1.0f, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_BurningShip_AVX2)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Multibrot_AVX2(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_nsimdBase(xBegin, xEnd, yBegin, yEnd, width, height, image); 
+        multibrot_avx2(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
     }
 }
-BENCHMARK(BM_Mandelbrot_NSIMD_BASE)
+BENCHMARK(BM_Multibrot_AVX2)
+    ->Apply(PowerArguments)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -256,17 +410,53 @@ BENCHMARK(BM_Mandelbrot_NSIMD_BASE)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif
 
+static void BM_Mandelbrot_AVX2_Packed(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint8_t []> bitmap = hwy::AllocateAligned<uint8_t>(width * height / 8);
 
-static void BM_Mandelbrot_SIMDe(benchmark::State& state) {
-    __attribute__((aligned(64))) float image[width * height] = {0};
+    for (auto _ : state) {
+        mandelbrot_avx2_packed(xBegin, xEnd, yBegin, yEnd, width, height, &bitmap[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX2_Packed)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX2_Refill(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_simde_avx2(xBegin, xEnd, yBegin, yEnd, width, height, image); 
+        mandelbrot_avx2_refill(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
     }
 }
-BENCHMARK(BM_Mandelbrot_SIMDe)
+BENCHMARK(BM_Mandelbrot_AVX2_Refill)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+#endif 	// NEON
+#endif 	// AVX512
+
+
+static void BM_Mandelbrot_Highway(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_highway(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Highway)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -276,18 +466,36 @@ BENCHMARK(BM_Mandelbrot_SIMDe)
     return *(std::min_element(std::begin(v), std::end(v)));
     });
 
+// The label shows the target which was chosen at runtime
+static void BM_Mandelbrot_Highway_Dispatch(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_highway_dispatch(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetLabel(mandelbrot_highway_dispatch_target());
+}
+BENCHMARK(BM_Mandelbrot_Highway_Dispatch)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
 
 #ifndef NEON
 #ifndef SVE
-#ifdef AVX512
-static void BM_Mandelbrot_AVX512(benchmark::State& state) {
-    __attribute__((aligned(64))) float image[width * height] = {0};
+static void BM_Mandelbrot_Intrinsics_Dispatch(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_avx512(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_intrinsics_dispatch(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
     }
+    state.SetLabel(mandelbrot_intrinsics_dispatch_target());
 }
-BENCHMARK(BM_Mandelbrot_AVX512)
+BENCHMARK(BM_Mandelbrot_Intrinsics_Dispatch)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -296,20 +504,36 @@ BENCHMARK(BM_Mandelbrot_AVX512)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif	// AVX512
 #endif	// SVE
-#endif	// NEON 
+#endif	// NEON
 
+static void BM_Mandelbrot_Highway_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
-#ifdef NEON
-static void BM_Mandelbrot_NEON(benchmark::State& state) {
-    __attribute__((aligned(64))) float image[width * height] = {0};
+    for (auto _ : state) {
+        mandelbrot_highway_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Highway_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Highway_Periodicity(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    float tolerance = std::pow(10.0f, -(float) state.range(0));
 
     for (auto _ : state) {
-        mandelbrot_neon(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_highway_periodicity(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], tolerance);
     }
 }
-BENCHMARK(BM_Mandelbrot_NEON)
+BENCHMARK(BM_Mandelbrot_Highway_Periodicity)
+    ->Apply(ToleranceArguments)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -318,18 +542,33 @@ BENCHMARK(BM_Mandelbrot_NEON)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif
 
+static void BM_Mandelbrot_Highway_MaxIterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
-#ifdef SVE
-static void BM_Mandelbrot_SVE(benchmark::State& state) {
-    __attribute__((aligned(64))) float image[width * height] = {0};
+    for (auto _ : state) {
+        mandelbrot_highway(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0), BAILOUT);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Highway_MaxIterations)
+    ->Apply(IterationArguments)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Highway_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
 
     for (auto _ : state) {
-        mandelbrot_sve(xBegin, xEnd, yBegin, yEnd, width, height, image);
+        mandelbrot_highway_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
     }
 }
-BENCHMARK(BM_Mandelbrot_SVE)
+BENCHMARK(BM_Mandelbrot_Highway_Iterations)
     ->Repetitions(BENCHMARK_REPETITIONS)
     ->DisplayAggregatesOnly(true)
     ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
@@ -338,6 +577,1268 @@ BENCHMARK(BM_Mandelbrot_SVE)
     ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
     });
-#endif 	// SVE
 
-BENCHMARK_MAIN();
+static void BM_Mandelbrot_Highway_Smooth(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_highway_smooth(xBegin, xEnd, yBegin, yEnd, width, height, &smooth[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Highway_Smooth)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Colorize_Highway_Smooth(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgb = hwy::AllocateAligned<uint8_t>(3 * width * height);
+    mandelbrot_highway_smooth(xBegin, xEnd, yBegin, yEnd, width, height, &smooth[0]);
+
+    for (auto _ : state) {
+        colorize_highway_smooth(&smooth[0], width * height, MAX_ITERATIONS + 1, &rgb[0]);
+    }
+    state.SetBytesProcessed(state.iterations() * width * height * (sizeof(float) + 3));
+}
+BENCHMARK(BM_Colorize_Highway_Smooth)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Colorize_Highway_Palette(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgb = hwy::AllocateAligned<uint8_t>(3 * width * height);
+    uint32_t palette[256];
+    createPolynomialPalette(palette, 256);
+    mandelbrot_highway_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+
+    for (auto _ : state) {
+        colorize_highway_palette(&iterations[0], width * height, palette, 256, &rgb[0]);
+    }
+    state.SetBytesProcessed(state.iterations() * width * height * (sizeof(uint32_t) + 3));
+}
+BENCHMARK(BM_Colorize_Highway_Palette)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Color(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgb = hwy::AllocateAligned<uint8_t>(3 * width * height);
+
+    for (auto _ : state) {
+        mandelbrot_color(mandelbrot_highway_smooth_block, xBegin, xEnd, yBegin, yEnd, width, height, &rgb[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Color)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Julia_Highway(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        julia_highway(-1.5f, 1.5f, -1.5f, 1.5f, width, height, &image[0], juliaReal, juliaImag);
+    }
+}
+BENCHMARK(BM_Julia_Highway)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_BurningShip_Highway(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        burningShip_highway(-2.0f, 1.5f, -2.0f, 1.0f, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_BurningShip_Highway)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Multibrot_Highway(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        multibrot_highway(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Multibrot_Highway)
+    ->Apply(PowerArguments)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Highway_Packed(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint8_t []> bitmap = hwy::AllocateAligned<uint8_t>(width * height / 8);
+
+    for (auto _ : state) {
+        mandelbrot_highway_packed(xBegin, xEnd, yBegin, yEnd, width, height, &bitmap[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Highway_Packed)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Highway_Refill(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_highway_refill(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Highway_Refill)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+
+#ifndef AVX512
+#ifndef NEON
+#ifndef SVE
+static void BM_Mandelbrot_Vc(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_vc(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
+    }
+}
+BENCHMARK(BM_Mandelbrot_Vc)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Vc_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_vc_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
+    }
+}
+BENCHMARK(BM_Mandelbrot_Vc_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Vc_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_vc_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Vc_Iterations)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+#endif 	// NEON
+#endif 	// AVX512
+
+
+#ifndef SVE
+static void BM_Mandelbrot_Libsimdpp(benchmark::State& state) {
+#ifndef AVX512
+    simdpp::aligned_allocator<float, 32> allocator;
+#else
+    simdpp::aligned_allocator<float, 64> allocator;
+#endif    
+    float * image = allocator.allocate(width * height); 
+
+    for (auto _ : state) {
+        mandelbrot_libsimdpp(xBegin, xEnd, yBegin, yEnd, width, height, image);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Libsimdpp)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Libsimdpp_InteriorCheck(benchmark::State& state) {
+#ifndef AVX512
+    simdpp::aligned_allocator<float, 32> allocator;
+#else
+    simdpp::aligned_allocator<float, 64> allocator;
+#endif    
+    float * image = allocator.allocate(width * height); 
+
+    for (auto _ : state) {
+        mandelbrot_libsimdpp_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, image);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Libsimdpp_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Libsimdpp_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_libsimdpp_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Libsimdpp_Iterations)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif
+
+
+static void BM_Mandelbrot_Pure_Simd(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_pure_simd(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Pure_Simd)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_Pure_Simd_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_pure_simd_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_Pure_Simd_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+#ifndef SVE
+static void BM_Mandelbrot_NSIMD(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_nsimd(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
+    }
+}
+BENCHMARK(BM_Mandelbrot_NSIMD)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif
+
+
+#ifndef SVE
+static void BM_Mandelbrot_NSIMD_BASE(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_nsimdBase(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
+    }
+}
+BENCHMARK(BM_Mandelbrot_NSIMD_BASE)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif
+
+
+static void BM_Mandelbrot_SIMDe(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_simde_avx2(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]); 
+    }
+}
+BENCHMARK(BM_Mandelbrot_SIMDe)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_SIMDe_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_simde_avx2_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_SIMDe_Iterations)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+static void BM_Mandelbrot_AVX512(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx512(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX512)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX512_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx512_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX512_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX512_Periodicity(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    float tolerance = std::pow(10.0f, -(float) state.range(0));
+
+    for (auto _ : state) {
+        mandelbrot_avx512_periodicity(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], tolerance);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX512_Periodicity)
+    ->Apply(ToleranceArguments)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX512_MaxIterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx512(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0), BAILOUT);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX512_MaxIterations)
+    ->Apply(IterationArguments)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX512_Interleaved(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx512_interleaved(xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX512_Interleaved)
+    ->Apply(InterleaveArguments)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX512_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx512_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX512_Iterations)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX512_Packed(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint8_t []> bitmap = hwy::AllocateAligned<uint8_t>(width * height / 8);
+
+    for (auto _ : state) {
+        mandelbrot_avx512_packed(xBegin, xEnd, yBegin, yEnd, width, height, &bitmap[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_AVX512_Packed)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// AVX512
+#endif	// SVE
+#endif	// NEON 
+
+
+#ifdef NEON
+static void BM_Mandelbrot_NEON(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_neon(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_NEON)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_NEON_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_neon_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_NEON_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_NEON_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_neon_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_NEON_Iterations)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif
+
+
+#ifdef SVE
+static void BM_Mandelbrot_SVE(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_sve(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_SVE)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_SVE_InteriorCheck(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_sve_interiorCheck(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_SVE_InteriorCheck)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_SVE_Iterations(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_sve_iterations(xBegin, xEnd, yBegin, yEnd, width, height, &iterations[0]);
+    }
+}
+BENCHMARK(BM_Mandelbrot_SVE_Iterations)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif 	// SVE
+
+// Float and double precision on the same viewport, the items per second are pixels per second
+template <typename T>
+static void BM_Mandelbrot_Scalar_Precision(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<T []> image = hwy::AllocateAligned<T>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_scalar_precision<T>(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Scalar_Precision, float)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Scalar_Precision, double)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+template <typename T>
+static void BM_Mandelbrot_Highway_Precision(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<T []> image = hwy::AllocateAligned<T>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_highway_precision<T>(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Highway_Precision, float)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Highway_Precision, double)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+#ifndef NEON
+#ifndef SVE
+template <typename T>
+static void BM_Mandelbrot_Vc_Precision(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<T []> image = hwy::AllocateAligned<T>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_vc_precision<T>(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Vc_Precision, float)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Vc_Precision, double)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+#endif	// NEON
+
+#ifndef SVE
+template <typename T>
+static void BM_Mandelbrot_Libsimdpp_Precision(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<T []> image = hwy::AllocateAligned<T>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_libsimdpp_precision<T>(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Libsimdpp_Precision, float)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+BENCHMARK_TEMPLATE(BM_Mandelbrot_Libsimdpp_Precision, double)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+
+#ifndef AVX512
+#ifndef NEON
+#ifndef SVE
+static void BM_Mandelbrot_AVX2_Precision_Float(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx2(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_Mandelbrot_AVX2_Precision_Float)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX2_Precision_Double(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<double []> image = hwy::AllocateAligned<double>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx2_double(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_Mandelbrot_AVX2_Precision_Double)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+#endif	// NEON
+#endif	// AVX512
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+static void BM_Mandelbrot_AVX512_Precision_Float(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx512(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_Mandelbrot_AVX512_Precision_Float)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+static void BM_Mandelbrot_AVX512_Precision_Double(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<double []> image = hwy::AllocateAligned<double>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_avx512_double(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_Mandelbrot_AVX512_Precision_Double)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// AVX512
+#endif	// SVE
+#endif	// NEON
+
+// Deep zoom far beyond double precision, rendered with perturbation theory
+static const char * deepZoomReal = "-1.76938317919551501821384728608547378290574726365475";
+static const char * deepZoomImag = "0.00423684791873677221492650717136799707668267091740";
+static const double deepZoomRadius = 1e-30;
+
+#ifndef NEON
+#ifndef SVE
+static void BM_Mandelbrot_Perturbation_AVX2(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    DoubleDouble xCenter = parseDoubleDouble(deepZoomReal);
+    DoubleDouble yCenter = parseDoubleDouble(deepZoomImag);
+
+    for (auto _ : state) {
+        mandelbrot_perturbation_avx2(xCenter, yCenter, deepZoomRadius, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_Mandelbrot_Perturbation_AVX2)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+#endif	// NEON
+
+static void BM_Mandelbrot_Perturbation_Highway(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    DoubleDouble xCenter = parseDoubleDouble(deepZoomReal);
+    DoubleDouble yCenter = parseDoubleDouble(deepZoomImag);
+
+    for (auto _ : state) {
+        mandelbrot_perturbation_highway(xCenter, yCenter, deepZoomRadius, width, height, &image[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_Mandelbrot_Perturbation_Highway)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+// Reports how many of the pixels were actually iterated by the kernel
+static void SubdivisionCounters(benchmark::State& state, size_t iterated) {
+    state.counters["pixels"] = width * height;
+    state.counters["iterated"] = iterated;
+    state.counters["iterated_ratio"] = (double) iterated / (width * height);
+}
+
+#ifndef AVX512
+#ifndef NEON
+#ifndef SVE
+static void BM_Mandelbrot_Subdivision_AVX2(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    size_t iterated = 0;
+
+    for (auto _ : state) {
+        iterated = mandelbrot_subdivision(mandelbrot_avx2_block, xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    SubdivisionCounters(state, iterated);
+}
+BENCHMARK(BM_Mandelbrot_Subdivision_AVX2)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+#endif	// NEON
+#endif	// AVX512
+
+static void BM_Mandelbrot_Subdivision_Highway(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    size_t iterated = 0;
+
+    for (auto _ : state) {
+        iterated = mandelbrot_subdivision(mandelbrot_highway_block, xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+    }
+    SubdivisionCounters(state, iterated);
+}
+BENCHMARK(BM_Mandelbrot_Subdivision_Highway)
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+// Runs the threaded benchmarks with 1, 2, 4, ... threads up to the number of hardware threads
+static void ThreadArguments(benchmark::internal::Benchmark* b) {
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        b->Arg(threads);
+    }
+    b->Arg(maxThreads);
+}
+
+static void mandelbrot_autoVec_tile(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_autoVec(xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+
+static void BM_Mandelbrot_Threaded_AutoVec(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_threaded(mandelbrot_autoVec_tile, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_Threaded_AutoVec)
+    ->Apply(ThreadArguments)
+    ->UseRealTime()
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+#ifndef AVX512
+#ifndef NEON
+#ifndef SVE
+static void BM_Mandelbrot_Threaded_AVX2(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_threaded(mandelbrot_avx2, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_Threaded_AVX2)
+    ->Apply(ThreadArguments)
+    ->UseRealTime()
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+
+static void BM_Mandelbrot_Threaded_Vc(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_threaded(mandelbrot_vc, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_Threaded_Vc)
+    ->Apply(ThreadArguments)
+    ->UseRealTime()
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+#endif 	// NEON
+#endif 	// AVX512
+
+
+static void BM_Mandelbrot_Threaded_Highway(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_threaded(mandelbrot_highway, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_Threaded_Highway)
+    ->Apply(ThreadArguments)
+    ->UseRealTime()
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+static void BM_Mandelbrot_Threaded_AVX512(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_threaded(mandelbrot_avx512, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_Threaded_AVX512)
+    ->Apply(ThreadArguments)
+    ->UseRealTime()
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// AVX512
+#endif	// SVE
+#endif	// NEON
+
+
+#ifdef NEON
+static void BM_Mandelbrot_Threaded_NEON(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_threaded(mandelbrot_neon, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_Threaded_NEON)
+    ->Apply(ThreadArguments)
+    ->UseRealTime()
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// NEON
+
+
+#ifdef SVE
+static void BM_Mandelbrot_Threaded_SVE(benchmark::State& state) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    for (auto _ : state) {
+        mandelbrot_threaded(mandelbrot_sve, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], state.range(0));
+    }
+}
+BENCHMARK(BM_Mandelbrot_Threaded_SVE)
+    ->Apply(ThreadArguments)
+    ->UseRealTime()
+    ->Repetitions(BENCHMARK_REPETITIONS)
+    ->DisplayAggregatesOnly(true)
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+    })
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+    });
+#endif	// SVE
+
+// Renders with a kernel of the registry, on the calling thread or with mandelbrot_threaded
+/* Reports the instrumentation counters per frame rendered since the last reset, only available
+ * if the kernels were compiled with MANDELBROT_STATS. The counters include all render threads. */
+static void reportMandelbrotStats(benchmark::State& state, double frames) {
+    if (!mandelbrotStatsEnabled() || frames == 0) {
+        return;
+    }
+    MandelbrotStats stats = getMandelbrotStats();
+    state.counters["vector_iterations"] = benchmark::Counter(stats.vectorIterations / frames);
+    state.counters["lane_iterations"] = benchmark::Counter(stats.laneIterations / frames);
+    state.counters["useful_lane_iterations"] = benchmark::Counter(stats.usefulLaneIterations / frames);
+    state.counters["lane_utilization"] = benchmark::Counter(stats.laneUtilization());
+}
+
+static void BM_Mandelbrot_Registry(benchmark::State& state, MandelbrotKernel kernel) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    size_t threads = state.range(0);
+
+    resetMandelbrotStats();
+    for (auto _ : state) {
+        if (threads == 1) {
+            kernel(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+        } else {
+            mandelbrot_threaded(kernel, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], threads);
+        }
+    }
+    reportMandelbrotStats(state, state.iterations());
+}
+
+struct Viewport {
+    const char * name;
+    float xBegin;
+    float xEnd;
+    float yBegin;
+    float yEnd;
+};
+
+// Viewports of the sweep benchmarks with very different escape profiles
+static const Viewport sweepViewports[] = {
+    {"default", xBegin, xEnd, yBegin, yEnd},
+    {"exterior", 0.5f, 1.5f, 0.5f, 1.5f},           // Every point escapes after a few iterations
+    {"boundary", -0.8f, -0.7f, 0.05f, 0.15f},       // Seahorse valley
+    {"interior", -0.5f, 0.0f, -0.25f, 0.25f},       // Inside the main cardioid, no point escapes
+};
+
+/* Total number of iterations of a size x size image of the viewport, computed once with the
+ * Highway iterations kernel in bands of 16 rows, so that large images need no count array. */
+static double sweepIterations(size_t size, const Viewport & viewport) {
+    static std::map<std::pair<size_t, const Viewport *>, double> totals;
+    auto cached = totals.find({size, &viewport});
+    if (cached != totals.end()) {
+        return cached->second;
+    }
+
+    const size_t band = 16;
+    float yScale = (viewport.yEnd - viewport.yBegin) / size;
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(size * band);
+    double total = 0;
+    for (size_t j = 0; j < size; j += band) {
+        float bandBegin = viewport.yBegin + j * yScale;
+        mandelbrot_highway_iterations(viewport.xBegin, viewport.xEnd, bandBegin, bandBegin + band * yScale,
+                      size, band, &iterations[0]);
+        for (size_t i = 0; i < size * band; i++) {
+            total += iterations[i];
+        }
+    }
+    totals[{size, &viewport}] = total;
+    return total;
+}
+
+// Renders a size x size image into huge pages and reports pixels and iterations per second
+static void BM_Mandelbrot_Sweep(benchmark::State& state, MandelbrotKernel kernel, const Viewport * viewport) {
+    size_t size = state.range(0);
+    float * image = allocateHugePageArray(size * size);
+    if (image == nullptr) {
+        state.SkipWithError("Could not allocate the image");
+        return;
+    }
+
+    resetMandelbrotStats();
+    for (auto _ : state) {
+        kernel(viewport->xBegin, viewport->xEnd, viewport->yBegin, viewport->yEnd, size, size, image);
+    }
+    free(image);
+    reportMandelbrotStats(state, state.iterations());
+
+    state.counters["pixels"] = benchmark::Counter(size * size, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["iterations"] = benchmark::Counter(sweepIterations(size, *viewport),
+                                                      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Hand-written kernels and their counterparts written against VecComplex, both are run one after
+// the other to show the cost of the abstraction
+static const char * complexClassPairs[][2] = {
+    {"avx2", "complexClass_avx2"},
+    {"vc", "complexClass_vc"},
+    {"libsimdpp", "complexClass_libsimdpp"},
+    {"highway", "complexClass_highway"},
+};
+
+// The registry is only complete once main runs, so its benchmarks are registered here
+int main(int argc, char** argv) {
+    for (const MandelbrotKernelInfo & info : mandelbrotKernels()) {
+        if (!isaSupported(info.isa) || width % info.widthMultiple != 0) {
+            continue;
+        }
+        std::string name = std::string("BM_Mandelbrot_Registry/") + info.name;
+        benchmark::RegisterBenchmark(name.c_str(), BM_Mandelbrot_Registry, info.kernel)
+            ->Apply(ThreadArguments)
+            ->UseRealTime()
+            ->Repetitions(BENCHMARK_REPETITIONS)
+            ->DisplayAggregatesOnly(true)
+            ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+            return *(std::max_element(std::begin(v), std::end(v)));
+            })
+            ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+            return *(std::min_element(std::begin(v), std::end(v)));
+            });
+    }
+
+    // Sizes 64, 256, 1024, 4096 and 16384, the largest image takes 1 GiB
+    for (const MandelbrotKernelInfo & info : mandelbrotKernels()) {
+        if (!isaSupported(info.isa) || 64 % info.widthMultiple != 0) {
+            continue;
+        }
+        for (const Viewport & viewport : sweepViewports) {
+            std::string name = std::string("BM_Mandelbrot_Sweep/") + info.name + "/" + viewport.name;
+            benchmark::RegisterBenchmark(name.c_str(), BM_Mandelbrot_Sweep, info.kernel, &viewport)
+                ->RangeMultiplier(4)
+                ->Range(64, 16384)
+                ->Unit(benchmark::kMillisecond);
+        }
+    }
+
+    for (const auto & pair : complexClassPairs) {
+        for (const char * kernelName : pair) {
+            const MandelbrotKernelInfo * info = findMandelbrotKernel(kernelName);
+            if (info == nullptr || !isaSupported(info->isa) || width % info->widthMultiple != 0) {
+                continue;
+            }
+            std::string name = std::string("BM_Mandelbrot_ComplexClass/") + kernelName;
+            benchmark::RegisterBenchmark(name.c_str(), BM_Mandelbrot_Registry, info->kernel)
+                ->Arg(1)
+                ->Repetitions(BENCHMARK_REPETITIONS)
+                ->DisplayAggregatesOnly(true)
+                ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+                return *(std::max_element(std::begin(v), std::end(v)));
+                })
+                ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+                return *(std::min_element(std::begin(v), std::end(v)));
+                });
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
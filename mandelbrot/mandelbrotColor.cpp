@@ -0,0 +1,184 @@
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <hwy/highway.h>
+#include <hwy/aligned_allocator.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotColor.hpp"
+
+#if !defined(NEON) && !defined(SVE)
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+/* The palette factors are premultiplied with 255, the channels are rounded to the nearest integer. */
+#define RED_FACTOR (9.0f * 255)
+#define GREEN_FACTOR (15.0f * 255)
+#define BLUE_FACTOR (8.5f * 255)
+
+void createPolynomialPalette(uint32_t * palette, size_t size) {
+    for (size_t k = 0; k < size; k++) {
+        float t = (size > 1) ? (float) k / (size - 1) : 0.0f;
+        float s = 1.0f - t;
+        uint32_t r = (uint32_t) (RED_FACTOR * s * t * t * t + 0.5f);
+        uint32_t g = (uint32_t) (GREEN_FACTOR * s * s * t * t + 0.5f);
+        uint32_t b = (uint32_t) (BLUE_FACTOR * s * s * s * t + 0.5f);
+        palette[k] = r | (g << 8) | (b << 16);
+    }
+}
+
+
+#ifndef NEON
+#ifndef SVE
+/* Packs eight 0x00BBGGRR pixels to 24 bytes. Both 128 bit lanes are compacted to 12 bytes and
+ * stored with 16 byte stores, the surplus bytes are overwritten by the next store. Only the last
+ * vector of an array goes through a buffer, so that nothing is written past its end. */
+static inline void storeRGB(__m256i pixels, uint8_t * rgb, bool last) {
+    const __m256i compact = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+                                             0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    __m256i packed = _mm256_shuffle_epi8(pixels, compact);
+
+    if (!last) {
+        _mm_storeu_si128((__m128i *) rgb, _mm256_castsi256_si128(packed));
+        _mm_storeu_si128((__m128i *) (rgb + 12), _mm256_extracti128_si256(packed, 1));
+    } else {
+        uint8_t buffer[28];
+        _mm_storeu_si128((__m128i *) buffer, _mm256_castsi256_si128(packed));
+        _mm_storeu_si128((__m128i *) (buffer + 12), _mm256_extracti128_si256(packed, 1));
+        memcpy(rgb, buffer, 24);
+    }
+}
+
+void colorize_avx2_smooth(const float * smooth, size_t count, float maxValue, uint8_t * rgb) {
+    assert(count % 8 == 0);
+
+    __m256 scaleVec = _mm256_set1_ps(1.0f / maxValue);
+    __m256 zeroVec = _mm256_setzero_ps();
+    __m256 oneVec = _mm256_set1_ps(1.0f);
+    __m256 redVec = _mm256_set1_ps(RED_FACTOR);
+    __m256 greenVec = _mm256_set1_ps(GREEN_FACTOR);
+    __m256 blueVec = _mm256_set1_ps(BLUE_FACTOR);
+
+    for (size_t i = 0; i < count; i += 8) {
+        __m256 t = _mm256_mul_ps(_mm256_loadu_ps(&smooth[i]), scaleVec);
+        t = _mm256_min_ps(_mm256_max_ps(t, zeroVec), oneVec);
+        __m256 s = _mm256_sub_ps(oneVec, t);
+        __m256 t_squared = _mm256_mul_ps(t, t);
+        __m256 s_squared = _mm256_mul_ps(s, s);
+
+        __m256 red = _mm256_mul_ps(_mm256_mul_ps(redVec, s), _mm256_mul_ps(t_squared, t));
+        __m256 green = _mm256_mul_ps(_mm256_mul_ps(greenVec, s_squared), t_squared);
+        __m256 blue = _mm256_mul_ps(_mm256_mul_ps(blueVec, s_squared), _mm256_mul_ps(s, t));
+
+        __m256i pixels = _mm256_or_si256(_mm256_cvtps_epi32(red),
+                         _mm256_or_si256(_mm256_slli_epi32(_mm256_cvtps_epi32(green), 8),
+                                         _mm256_slli_epi32(_mm256_cvtps_epi32(blue), 16)));
+        storeRGB(pixels, &rgb[3 * i], i + 8 == count);
+    }
+}
+
+void colorize_avx2_palette(const uint32_t * iterations, size_t count,
+                     const uint32_t * palette, size_t paletteSize, uint8_t * rgb) {
+    assert(count % 8 == 0);
+    assert(paletteSize > 0 && (paletteSize & (paletteSize - 1)) == 0);
+
+    __m256i indexMaskVec = _mm256_set1_epi32(paletteSize - 1);
+    __m256i maxIterationsVec = _mm256_set1_epi32(MAX_ITERATIONS);
+
+    for (size_t i = 0; i < count; i += 8) {
+        __m256i counts = _mm256_loadu_si256((const __m256i *) &iterations[i]);
+        __m256i pixels = _mm256_i32gather_epi32((const int *) palette, _mm256_and_si256(counts, indexMaskVec), 4);
+
+        // Points inside the set reached MAX_ITERATIONS + 1, the counts are far below 2^31
+        __m256i inside = _mm256_cmpgt_epi32(counts, maxIterationsVec);
+        storeRGB(_mm256_andnot_si256(inside, pixels), &rgb[3 * i], i + 8 == count);
+    }
+}
+#endif
+#endif
+
+
+HWY_BEFORE_NAMESPACE();
+HWY_ATTR void colorize_highway_smooth(const float* HWY_RESTRICT smooth, size_t count, float maxValue,
+                     uint8_t* HWY_RESTRICT rgb) {
+    using namespace hwy;
+    using namespace HWY_NAMESPACE;
+
+    const ScalableTag<float> d;
+    const Rebind<uint8_t, decltype(d)> d8;
+    const size_t N = Lanes(d);
+
+    assert(count % N == 0); // Ensure that vector lanes fit
+
+    auto scaleVec = Set(d, 1.0f / maxValue);
+    auto zeroVec = Zero(d);
+    auto oneVec = Set(d, 1.0f);
+    auto redVec = Set(d, RED_FACTOR);
+    auto greenVec = Set(d, GREEN_FACTOR);
+    auto blueVec = Set(d, BLUE_FACTOR);
+
+    for (size_t i = 0; i < count; i += N) {
+        auto t = Mul(LoadU(d, &smooth[i]), scaleVec);
+        t = Min(Max(t, zeroVec), oneVec);
+        auto s = Sub(oneVec, t);
+        auto t_squared = Mul(t, t);
+        auto s_squared = Mul(s, s);
+
+        auto red = Mul(Mul(redVec, s), Mul(t_squared, t));
+        auto green = Mul(Mul(greenVec, s_squared), t_squared);
+        auto blue = Mul(Mul(blueVec, s_squared), Mul(s, t));
+
+        StoreInterleaved3(DemoteTo(d8, NearestInt(red)), DemoteTo(d8, NearestInt(green)),
+                          DemoteTo(d8, NearestInt(blue)), d8, &rgb[3 * i]);
+    }
+}
+
+HWY_ATTR void colorize_highway_palette(const uint32_t* HWY_RESTRICT iterations, size_t count,
+                     const uint32_t* HWY_RESTRICT palette, size_t paletteSize, uint8_t* HWY_RESTRICT rgb) {
+    using namespace hwy;
+    using namespace HWY_NAMESPACE;
+
+    const ScalableTag<uint32_t> du;
+    const RebindToSigned<decltype(du)> di;
+    const Rebind<uint8_t, decltype(du)> d8;
+    const size_t N = Lanes(du);
+
+    assert(count % N == 0); // Ensure that vector lanes fit
+    assert(paletteSize > 0 && (paletteSize & (paletteSize - 1)) == 0);
+
+    auto indexMaskVec = Set(du, paletteSize - 1);
+    auto maxIterationsVec = Set(du, MAX_ITERATIONS);
+    auto byteMaskVec = Set(du, 0xFF);
+
+    for (size_t i = 0; i < count; i += N) {
+        auto counts = LoadU(du, &iterations[i]);
+        auto pixels = GatherIndex(du, palette, BitCast(di, And(counts, indexMaskVec)));
+
+        // Points inside the set reached MAX_ITERATIONS + 1
+        pixels = IfThenZeroElse(Gt(counts, maxIterationsVec), pixels);
+
+        auto red = BitCast(di, And(pixels, byteMaskVec));
+        auto green = BitCast(di, And(ShiftRight<8>(pixels), byteMaskVec));
+        auto blue = BitCast(di, ShiftRight<16>(pixels));
+        StoreInterleaved3(DemoteTo(d8, red), DemoteTo(d8, green), DemoteTo(d8, blue), d8, &rgb[3 * i]);
+    }
+}
+HWY_AFTER_NAMESPACE();
+
+
+void mandelbrot_color(MandelbrotBlockKernel smoothKernel,
+                     float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, uint8_t * rgb) {
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    hwy::AlignedFreeUniquePtr<float []> band = hwy::AllocateAligned<float>(width * COLOR_BAND_HEIGHT);
+
+    // The bands are rows of the whole frame, so they hold the same values as a single render
+    for (size_t row = 0; row < height; row += COLOR_BAND_HEIGHT) {
+        size_t rows = std::min<size_t>(COLOR_BAND_HEIGHT, height - row);
+
+        smoothKernel(xBegin, yBegin, xScale, yScale, 0, row, width, rows, &band[0]);
+        colorize_highway_smooth(&band[0], width * rows, MAX_ITERATIONS + 1, &rgb[3 * row * width]);
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef mandelbrotColor
+#define mandelbrotColor
+
+#include <stddef.h>
+#include <stdint.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotThreaded.hpp"
+
+/* Colormap stage turning escape counts into interleaved 8 bit RGB, three bytes per pixel as
+ * written by writePixmapImage. Smooth values go through the polynomial palette
+ *      r = 9 (1 - t) t^3,  g = 15 (1 - t)^2 t^2,  b = 8.5 (1 - t)^3 t   with t = value / maxValue,
+ * which is black for t = 0 and for points inside the set at t = 1. Iteration counts index a
+ * table of 0x00BBGGRR entries with a gather, points inside the set are black. */
+
+// Rows rendered and colored at once by mandelbrot_color, the float values of a band stay in the cache
+#define COLOR_BAND_HEIGHT 16
+
+/**
+ * Fills a palette table by sampling the polynomial palette, so both colormaps can show the same colors.
+ *
+ * @param palette
+ *          The table receiving 0x00BBGGRR entries
+ * @param size
+ *          The number of entries
+ *
+*/
+void createPolynomialPalette(uint32_t * palette, size_t size);
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Maps smooth escape counts to RGB with the polynomial palette, employing vectorization by using intrinsics.
+ *
+ * @param smooth
+ *          The smooth values, e.g. of mandelbrot_avx2_smooth
+ * @param count
+ *          The number of pixels, a multiple of 8
+ * @param maxValue
+ *          The value mapped to the end of the palette, larger values are clamped
+ * @param rgb
+ *          The array receiving 3 * count bytes
+ *
+*/
+void colorize_avx2_smooth(const float * smooth, size_t count, float maxValue, uint8_t * rgb);
+
+/**
+ * Maps iteration counts to RGB by gathering from a palette table, employing vectorization by using intrinsics.
+ *
+ * @param iterations
+ *          The iteration counts, e.g. of mandelbrot_avx2_iterations
+ * @param count
+ *          The number of pixels, a multiple of 8
+ * @param palette
+ *          The table of 0x00BBGGRR entries, the count modulo the size selects the entry
+ * @param paletteSize
+ *          The number of entries, a power of two
+ * @param rgb
+ *          The array receiving 3 * count bytes
+ *
+*/
+void colorize_avx2_palette(const uint32_t * iterations, size_t count,
+                     const uint32_t * palette, size_t paletteSize, uint8_t * rgb);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Maps smooth escape counts to RGB with the polynomial palette, employing vectorization by using the Highway library.
+ *
+ * @param smooth
+ *          The smooth values, e.g. of mandelbrot_highway_smooth
+ * @param count
+ *          The number of pixels, a multiple of the vector size
+ * @param maxValue
+ *          The value mapped to the end of the palette, larger values are clamped
+ * @param rgb
+ *          The array receiving 3 * count bytes
+ *
+*/
+HWY_ATTR void colorize_highway_smooth(const float* HWY_RESTRICT smooth, size_t count, float maxValue,
+                     uint8_t* HWY_RESTRICT rgb);
+
+/**
+ * Maps iteration counts to RGB by gathering from a palette table, employing vectorization by using the Highway library.
+ *
+ * @param iterations
+ *          The iteration counts, e.g. of mandelbrot_highway_iterations
+ * @param count
+ *          The number of pixels, a multiple of the vector size
+ * @param palette
+ *          The table of 0x00BBGGRR entries, the count modulo the size selects the entry
+ * @param paletteSize
+ *          The number of entries, a power of two
+ * @param rgb
+ *          The array receiving 3 * count bytes
+ *
+*/
+HWY_ATTR void colorize_highway_palette(const uint32_t* HWY_RESTRICT iterations, size_t count,
+                     const uint32_t* HWY_RESTRICT palette, size_t paletteSize, uint8_t* HWY_RESTRICT rgb);
+
+/**
+ * Renders a color image of the mandelbrot set in bands of COLOR_BAND_HEIGHT rows, every band is
+ *  colored with colorize_highway_smooth right after the kernel wrote it.
+ *
+ * @param smoothKernel
+ *          The block kernel writing smooth values, mandelbrot_avx2_smooth_block or mandelbrot_highway_smooth_block
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the vector size
+ * @param heigth
+ *          The height of the image
+ * @param rgb
+ *          The array receiving 3 * width * height bytes
+ *
+*/
+void mandelbrot_color(MandelbrotBlockKernel smoothKernel,
+                     float realBeginning, float realEnd,
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, uint8_t * rgb);
+
+#endif
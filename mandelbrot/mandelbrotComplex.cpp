@@ -0,0 +1,89 @@
+#include <assert.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotComplex.hpp"
+#include "mandelbrotEscapeTimeEngine.hpp"
+#include "mandelbrotRegistry.hpp"
+#include "../utils/vecComplex.hpp"
+
+using namespace escape_time;
+
+template <class B>
+static void mandelbrot_complexClass_kernel(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    typedef typename B::V V;
+    typedef VecComplex<V, B> Z;
+    const size_t N = B::lanes();
+    assert((width * height) % N == 0);
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    V xScaleVec = B::set(xScale);
+    V xBeginVec = B::set(xBegin);
+    V bailoutVec = B::set(BAILOUT);
+    V zeroVec = B::set(0.0f);
+    V oneVec = B::set(1.0f);
+
+    for (size_t j = 0; j < height; j++) {
+        V c_imag = B::set(yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += N) {
+            V c_real = B::add(B::mul(B::iota(i), xScaleVec), xBeginVec);
+
+            Z z(zeroVec, zeroVec);
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                /* the norm of the previous z decides, like in the hand-written kernels */
+                typename Z::Mask active = z.bounded(bailoutVec);
+                if (B::none(active) || iteration > MAX_ITERATIONS) {
+                    B::store(B::select(active, oneVec, zeroVec), &image[(j * width) + i]);
+                    break;
+                }
+                z = z.mandelIterate(c_real, c_imag, active);
+            }
+        }
+    }
+}
+
+
+#ifndef NEON
+#ifndef SVE
+void mandelbrot_complexClass_avx2(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image) {
+    mandelbrot_complexClass_kernel<AVX2Backend>(xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+REGISTER_MANDELBROT_KERNEL(complexClass_avx2, "complexClass_avx2", ISA_AVX2, mandelbrot_complexClass_avx2, nullptr, 8);
+
+void mandelbrot_complexClass_vc(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image) {
+    mandelbrot_complexClass_kernel<VcBackend>(xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+REGISTER_MANDELBROT_KERNEL(complexClass_vc, "complexClass_vc", ISA_ANY, mandelbrot_complexClass_vc, nullptr,
+                      Vc::float_v::Size);
+#endif	// SVE
+#endif	// NEON
+
+#ifndef SVE
+void mandelbrot_complexClass_libsimdpp(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image) {
+    mandelbrot_complexClass_kernel<LibsimdppBackend>(xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+REGISTER_MANDELBROT_KERNEL(complexClass_libsimdpp, "complexClass_libsimdpp", ISA_ANY,
+                      mandelbrot_complexClass_libsimdpp, nullptr, SIMDPP_FAST_FLOAT32_SIZE);
+
+HWY_BEFORE_NAMESPACE();
+HWY_ATTR void mandelbrot_complexClass_highway(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image) {
+    mandelbrot_complexClass_kernel<HighwayBackend>(xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+HWY_AFTER_NAMESPACE();
+REGISTER_MANDELBROT_KERNEL(complexClass_highway, "complexClass_highway", ISA_ANY, mandelbrot_complexClass_highway,
+                      nullptr, HWY_LANES(float));
+#endif	// SVE
@@ -0,0 +1,113 @@
+#ifndef mandelbrotComplex
+#define mandelbrotComplex
+
+#include <stddef.h>
+
+/* The kernels share one loop written against VecComplex, only the backend of the escape-time
+ * engine in mandelbrotEscapeTimeEngine.hpp differs. Lanes that escaped are masked out of mandelIterate and keep their last value. They are registered as
+ * complexClass_avx2, complexClass_vc, complexClass_libsimdpp and complexClass_highway, next to the
+ * hand-written kernels of mandelbrot.hpp they are benchmarked against. */
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions,
+ *  employing vectorization by using intrinsics through the VecComplex class.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of 8
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+void mandelbrot_complexClass_avx2(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image);
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions,
+ *  employing vectorization by using the Vc library through the VecComplex class.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the vector size
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+void mandelbrot_complexClass_vc(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image);
+#endif	// SVE
+#endif	// NEON
+
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions,
+ *  employing vectorization by using the libsimdpp library through the VecComplex class.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the vector size
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+void mandelbrot_complexClass_libsimdpp(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image);
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions,
+ *  employing vectorization by using the Highway library through the VecComplex class.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the vector size
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+void mandelbrot_complexClass_highway(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image);
+#endif	// SVE
+
+#endif
@@ -0,0 +1,101 @@
+#include <assert.h>
+
+// Compiles this file once for every Highway target, HWY_ONCE is only true in the last pass
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "mandelbrot/mandelbrotDispatch.cpp"
+#include <hwy/foreach_target.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotHighway-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace mandelbrotTargets {
+namespace HWY_NAMESPACE {
+
+// mandelbrot_highway compiled for this target
+void MandelbrotHighway(float xBegin, float xEnd, 
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout) {
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    dispatchIterations(maxIterations, [&](auto fixedIterations) {
+        MandelbrotHighwayKernel<false, decltype(fixedIterations)::value>(xBegin, yBegin, xScale, yScale, 0, 0,
+                      width, height, image, maxIterations, bailout);
+    });
+}
+
+const char * MandelbrotHighwayTarget() {
+    return hwy::TargetName(HWY_TARGET);
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace mandelbrotTargets
+HWY_AFTER_NAMESPACE();
+
+
+#if HWY_ONCE
+#include "mandelbrot.hpp"
+#include "mandelbrotDispatch.hpp"
+#include "mandelbrotRegistry.hpp"
+
+namespace mandelbrotTargets {
+HWY_EXPORT(MandelbrotHighway);
+HWY_EXPORT(MandelbrotHighwayTarget);
+}  // namespace mandelbrotTargets
+
+void mandelbrot_highway_dispatch(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_highway_dispatch(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_highway_dispatch(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    HWY_DYNAMIC_DISPATCH(mandelbrotTargets::MandelbrotHighway)(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+}
+
+const char * mandelbrot_highway_dispatch_target() {
+    return HWY_DYNAMIC_DISPATCH(mandelbrotTargets::MandelbrotHighwayTarget)();
+}
+// The chosen target may have wider vectors than the static one, 64 floats fit all of them
+REGISTER_MANDELBROT_KERNEL(highway_dispatch, "highway_dispatch", ISA_ANY, mandelbrot_highway_dispatch, nullptr, 64);
+
+
+#ifndef NEON
+#ifndef SVE
+static bool supportsAVX512() {
+    // Evaluated once, CPUID does not change while the program runs
+    static const bool supported = __builtin_cpu_supports("avx512f");
+    return supported;
+}
+
+void mandelbrot_intrinsics_dispatch(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_intrinsics_dispatch(xBegin, xEnd, yBegin, yEnd, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_intrinsics_dispatch(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    if (supportsAVX512()) {
+        mandelbrot_avx512(xBegin, xEnd, yBegin, yEnd, width, height, image, maxIterations, bailout);
+    } else {
+        mandelbrot_avx2(xBegin, xEnd, yBegin, yEnd, width, height, image, maxIterations, bailout);
+    }
+}
+
+const char * mandelbrot_intrinsics_dispatch_target() {
+    return supportsAVX512() ? "AVX512" : "AVX2";
+}
+REGISTER_MANDELBROT_KERNEL(intrinsics_dispatch, "intrinsics_dispatch", ISA_AVX2, mandelbrot_intrinsics_dispatch, nullptr, 16);
+#endif	// SVE
+#endif	// NEON
+#endif  // HWY_ONCE
@@ -0,0 +1,139 @@
+#ifndef mandelbrotDispatch
+#define mandelbrotDispatch
+
+#include <stddef.h>
+
+/* Kernels that choose their instruction set when the program runs instead of when it is compiled.
+ * The Highway kernel of mandelbrot_highway is compiled once for every target Highway supports on
+ * this architecture and the best one for the processor is taken on the first call. The intrinsics
+ * kernel chooses between the hand written AVX2 and AVX512 code with CPUID. */
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using Google Highway with dynamic dispatch.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ * 
+*/
+void mandelbrot_highway_dispatch(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using Google Highway with dynamic dispatch.
+ *  The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_highway_dispatch(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+
+/**
+ * Returns the name of the Highway target mandelbrot_highway_dispatch runs on this processor,
+ *  e.g. "AVX2" or "AVX3".
+ *
+ * @return  The name of the target
+*/
+const char * mandelbrot_highway_dispatch_target();
+
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing mandelbrot_avx512 on processors that support AVX512F and mandelbrot_avx2 
+ *  otherwise. The width has to be a multiple of 16.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ * 
+*/
+void mandelbrot_intrinsics_dispatch(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions like
+ *  mandelbrot_intrinsics_dispatch. The iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_intrinsics_dispatch(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+
+/**
+ * Returns the instruction set mandelbrot_intrinsics_dispatch uses on this processor.
+ *
+ * @return  "AVX512" or "AVX2"
+*/
+const char * mandelbrot_intrinsics_dispatch_target();
+#endif	// SVE
+#endif	// NEON
+
+#endif	// mandelbrotDispatch
@@ -0,0 +1,351 @@
+#include <assert.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotDouble.hpp"
+
+#if !defined(NEON) && !defined(SVE)
+#include <Vc/Vc>
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+#ifndef SVE
+#include <simdpp/simd.h>
+#endif	// SVE
+
+
+template <typename T>
+void mandelbrot_scalar_precision(T xBegin, T xEnd,
+                      T yBegin, T yEnd,
+                      int width, int height, T * image) {
+
+    T xScale = (xEnd - xBegin) / width;
+    T yScale = (yEnd - yBegin) / height;
+
+    T c_real, c_imag, z_real, z_imag, temp, z_real_squared, z_imag_squared;
+
+    for (int j = 0; j < height; j++) {
+        for (int i = 0; i < width; i++) {
+
+            c_real = xBegin + i * xScale;
+            c_imag = yBegin + j * yScale;
+            z_real = 0.0;
+            z_imag = 0.0;
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+                temp = z_real * z_imag;
+                z_real_squared = z_real * z_real;
+                z_imag_squared = z_imag * z_imag;
+                z_real = z_real_squared - z_imag_squared + c_real;
+                z_imag = temp + temp + c_imag;
+
+                if (z_imag_squared + z_real_squared > BAILOUT) {
+                    * image++ = 0;
+                    break;
+                }
+
+                if (iteration > MAX_ITERATIONS) {
+                    * image++ = 1;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template void mandelbrot_scalar_precision<float>(float, float, float, float, int, int, float *);
+template void mandelbrot_scalar_precision<double>(double, double, double, double, int, int, double *);
+
+
+HWY_BEFORE_NAMESPACE();
+template <typename T>
+HWY_ATTR void mandelbrot_highway_precision(T xBegin, T xEnd,
+                      T yBegin, T yEnd,
+                      size_t width, size_t height, T * image) {
+    using namespace hwy;
+    using namespace HWY_NAMESPACE;
+
+    const ScalableTag<T> d;
+    const size_t N = Lanes(d);
+    using V = decltype(Zero(d));
+
+    assert((width * height) % N == 0); // Ensure that vector lanes fit
+
+    T xScale = (xEnd - xBegin) / width;
+    T yScale = (yEnd - yBegin) / height;
+
+    auto xScaleVec = Set(d, xScale);
+    auto xBeginVec = Set(d, xBegin);
+    auto bailoutVec = Set(d, BAILOUT);
+    auto oneVec = Set(d, 1);
+
+    for (size_t j = 0; j < height; j++) {
+        auto c_imag = Set(d, yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += N) {
+            auto c_real = Iota(d, i);
+            c_real = MulAdd(c_real, xScaleVec, xBeginVec);
+
+            V z_real = Zero(d);
+            V z_imag = Zero(d);
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                auto z_real_squared = Mul(z_real, z_real);
+                auto z_imag_squared = Mul(z_imag, z_imag);
+                auto temp = Mul(z_real, z_imag);
+
+                z_real = Add(Sub(z_real_squared, z_imag_squared), c_real);
+                z_imag = Add(Add(temp, temp), c_imag);
+
+                /* masking of bailout values */
+                auto norm = Add(z_real_squared, z_imag_squared);
+                auto mask = Lt(norm, bailoutVec);
+
+                if (iteration > MAX_ITERATIONS || AllFalse(d, mask)) {
+                    Store(IfThenElseZero(mask, oneVec), d, &image[(j * width) + i]);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template void mandelbrot_highway_precision<float>(float, float, float, float, size_t, size_t, float *);
+template void mandelbrot_highway_precision<double>(double, double, double, double, size_t, size_t, double *);
+HWY_AFTER_NAMESPACE();
+
+
+#ifndef NEON
+#ifndef SVE
+template <typename T>
+void mandelbrot_vc_precision(T xBegin, T xEnd,
+                      T yBegin, T yEnd,
+                      size_t width, size_t height, T * image) {
+    typedef Vc::Vector<T> V;
+    typedef typename V::mask_type M;
+    assert((width * height) % V::Size == 0); // Ensure that vector lanes fit
+    T xScale = (xEnd - xBegin) / width;
+    T yScale = (yEnd - yBegin) / height;
+
+    for (size_t j = 0; j < height; j++) {
+        V c_imag = yBegin + j * yScale;
+        for (size_t i = 0; i < width; i += V::Size) {
+            V c_real = xBegin + (V::IndexesFromZero() + T(i)) * xScale;
+
+            V z_real = V::Zero();
+            V z_imag = V::Zero();
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+
+                V z_real_squared = z_real * z_real;
+                V z_imag_squared = z_imag * z_imag;
+                V temp = z_real * z_imag;
+
+                z_real = (z_real_squared - z_imag_squared) + c_real;
+                z_imag = temp + temp + c_imag;
+
+                V norm = z_real_squared + z_imag_squared;
+
+                M mask = norm < T(BAILOUT);
+                if (mask.isEmpty() || iteration > MAX_ITERATIONS) {
+                    V result = V::Zero();
+                    ++result(mask);
+                    result.store(&image[(j * width) + i], Vc::Unaligned);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template void mandelbrot_vc_precision<float>(float, float, float, float, size_t, size_t, float *);
+template void mandelbrot_vc_precision<double>(double, double, double, double, size_t, size_t, double *);
+
+
+void mandelbrot_avx2_double(double xBegin, double xEnd,
+                     double yBegin, double yEnd,
+                     size_t width, size_t height, double * image) {
+    assert((width * height) % 4 == 0);
+
+    double xScale = (xEnd - xBegin) / width;
+    double yScale = (yEnd - yBegin) / height;
+    __m256d xScaleVec = _mm256_set1_pd(xScale);
+    __m256d xBeginVec = _mm256_set1_pd(xBegin);
+    __m256d bailoutVec = _mm256_set1_pd(BAILOUT);
+    __m256d oneVec = _mm256_set1_pd(1);
+    __m256d zeroVec = _mm256_setzero_pd();
+
+    for (size_t j = 0; j < height; j++) {
+        __m256d c_imag = _mm256_set1_pd(yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += 4) {
+            __m256d c_real = _mm256_set_pd(4 + i, 3 + i, 2 + i, 1 + i);
+            c_real = _mm256_fmadd_pd(c_real, xScaleVec, xBeginVec);
+
+            __m256d z_real = _mm256_setzero_pd();
+            __m256d z_imag = _mm256_setzero_pd();
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                __m256d z_real_squared = _mm256_mul_pd(z_real, z_real);
+                __m256d z_imag_squared = _mm256_mul_pd(z_imag, z_imag);
+                __m256d temp = _mm256_mul_pd(z_real, z_imag);
+
+                z_real = _mm256_add_pd(_mm256_sub_pd(z_real_squared, z_imag_squared), c_real);
+                z_imag = _mm256_add_pd(_mm256_add_pd(temp, temp), c_imag);
+
+                __m256d norm = _mm256_add_pd(z_real_squared, z_imag_squared);
+
+                __m256d mask = _mm256_cmp_pd(norm, bailoutVec, _CMP_LT_OQ);
+
+                if (_mm256_movemask_pd(mask) == 0 || iteration > MAX_ITERATIONS) {
+                    __m256d result = _mm256_blendv_pd(zeroVec, oneVec, mask);
+                    _mm256_store_pd(&image[(j * width) + i], result);
+                    break;
+                }
+            }
+        }
+    }
+}
+#endif	// SVE
+#endif	// NEON
+
+
+#ifndef SVE
+/* libsimdpp names its vector types after the element size, so the template picks them here */
+template <typename T> struct SimdppTypes;
+
+template <> struct SimdppTypes<float> {
+    static const unsigned N = SIMDPP_FAST_FLOAT32_SIZE;
+    typedef simdpp::float32<N> Vector;
+    typedef simdpp::mask_float32<N> Mask;
+};
+
+template <> struct SimdppTypes<double> {
+    static const unsigned N = SIMDPP_FAST_FLOAT64_SIZE;
+    typedef simdpp::float64<N> Vector;
+    typedef simdpp::mask_float64<N> Mask;
+};
+
+template <typename T>
+void mandelbrot_libsimdpp_precision(T xBegin, T xEnd,
+                      T yBegin, T yEnd,
+                      size_t width, size_t height, T * image) {
+    using namespace simdpp;
+    const unsigned N = SimdppTypes<T>::N;
+    typedef typename SimdppTypes<T>::Vector V;
+    typedef typename SimdppTypes<T>::Mask M;
+    assert((width * height) % N == 0);
+    T xScale = (xEnd - xBegin) / width;
+    T yScale = (yEnd - yBegin) / height;
+
+    V xScaleVec = splat(xScale);
+    V xBeginVec = splat(xBegin);
+    V bailoutVec = splat(T(BAILOUT));
+    V zeroVec = splat(T(0));
+    V oneVec = splat(T(1));
+
+    SIMDPP_ALIGN(64) T offsets[N];
+    for (unsigned k = 0; k < N; k++) {
+        offsets[k] = k + 1;
+    }
+    V offsetVec = load(offsets);
+
+    for (size_t j = 0; j < height; j++) {
+        V c_imag = splat(yBegin + (j * yScale));
+
+        for (size_t i = 0; i < width; i += N) {
+            V c_real = add(offsetVec, splat(T(i)));
+            c_real = fmadd(c_real, xScaleVec, xBeginVec);
+
+            V z_real = splat(T(0));
+            V z_imag = splat(T(0));
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                V z_real_squared = mul(z_real, z_real);
+                V z_imag_squared = mul(z_imag, z_imag);
+                V temp = mul(z_real, z_imag);
+
+                z_real = add(sub(z_real_squared, z_imag_squared), c_real);
+                z_imag = add(add(temp, temp), c_imag);
+
+                V norm = add(z_real_squared, z_imag_squared);
+                M mask = cmp_lt(norm, bailoutVec);
+                V result = blend(oneVec, zeroVec, mask);
+
+                if (!test_bits_any(result) || iteration > MAX_ITERATIONS) {
+                    store(image + i + j*width, result);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template void mandelbrot_libsimdpp_precision<float>(float, float, float, float, size_t, size_t, float *);
+template void mandelbrot_libsimdpp_precision<double>(double, double, double, double, size_t, size_t, double *);
+#endif	// SVE
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+void mandelbrot_avx512_double(double xBegin, double xEnd,
+                      double yBegin, double yEnd,
+                      size_t width, size_t height, double * image) {
+    assert((width * height) % 8 == 0);
+    double xScale = (xEnd - xBegin) / width;
+    double yScale = (yEnd - yBegin) / height;
+
+    __m512d xScaleVec  = _mm512_set1_pd(xScale);
+    __m512d xBeginVec = _mm512_set1_pd(xBegin);
+    __m512d bailoutVec = _mm512_set1_pd(BAILOUT);
+    __m512d oneVec = _mm512_set1_pd(1);
+    __m512d zeroVec = _mm512_setzero_pd();
+
+    for (size_t j = 0; j < height; j++) {
+        __m512d c_imag = _mm512_set1_pd(yBegin + (j * yScale));
+
+        for (size_t i = 0; i < width; i += 8) {
+            __m512d c_real = _mm512_set_pd(8 + i, 7 + i, 6 + i, 5 + i, 4 + i, 3 + i, 2 + i, 1 + i);
+            c_real = _mm512_fmadd_pd(c_real, xScaleVec, xBeginVec);
+
+            __m512d z_real = _mm512_setzero_pd();
+            __m512d z_imag = _mm512_setzero_pd();
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+
+                __m512d z_real_squared = _mm512_mul_pd(z_real, z_real);
+                __m512d z_imag_squared = _mm512_mul_pd(z_imag, z_imag);
+                __m512d temp = _mm512_mul_pd(z_real, z_imag);
+
+                z_real = _mm512_add_pd(_mm512_sub_pd(z_real_squared, z_imag_squared), c_real);
+                z_imag = _mm512_add_pd(_mm512_add_pd(temp, temp), c_imag);
+
+                __m512d norm = _mm512_add_pd(z_real_squared, z_imag_squared);
+
+                __mmask8 mask = _mm512_cmp_pd_mask(norm, bailoutVec, _CMP_LT_OQ);
+
+                if ((int) mask == 0 || iteration > MAX_ITERATIONS) {
+                    _mm512_store_pd(&image[(j * width) + i], _mm512_mask_blend_pd(mask, zeroVec, oneVec));
+                    break;
+                }
+            }
+        }
+    }
+}
+#endif // AVX512
+#endif // SVE
+#endif // NEON
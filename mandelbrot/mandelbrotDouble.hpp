@@ -0,0 +1,177 @@
+#ifndef mandelbrotDouble
+#define mandelbrotDouble
+
+#include <stddef.h>
+#include <hwy/highway.h>
+
+/* Kernels for single and double precision. With float the pixels collapse once the width of the
+ * viewport approaches 1e-6, double precision reaches zooms of about 1e-14.
+ *
+ * The library kernels are templates over the element type and instantiated for float and double,
+ * the intrinsics kernels exist as double variants of mandelbrot_avx2 and mandelbrot_avx512. */
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions in the given precision.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+template <typename T>
+void mandelbrot_scalar_precision(T realBeginning, T realEnd,
+                      T imagBeginning, T imagEnd,
+                      int width, int height, T * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions in the given precision,
+ *  using Google Highway.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array, aligned to the vector size
+ *
+*/
+template <typename T>
+HWY_ATTR void mandelbrot_highway_precision(T realBeginning, T realEnd,
+                      T imagBeginning, T imagEnd,
+                      size_t width, size_t height, T * image);
+
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions in the given precision,
+ *  using the Vc library.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+template <typename T>
+void mandelbrot_vc_precision(T realBeginning, T realEnd,
+                      T imagBeginning, T imagEnd,
+                      size_t width, size_t height, T * image);
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions in double precision,
+ *  using AVX2 intrinsics.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array, aligned to 32 bytes
+ *
+*/
+void mandelbrot_avx2_double(double realBeginning, double realEnd,
+                      double imagBeginning, double imagEnd,
+                      size_t width, size_t height, double * image);
+#endif	// SVE
+#endif	// NEON
+
+
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions in the given precision,
+ *  using libsimdpp.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array, aligned to the vector size
+ *
+*/
+template <typename T>
+void mandelbrot_libsimdpp_precision(T realBeginning, T realEnd,
+                      T imagBeginning, T imagEnd,
+                      size_t width, size_t height, T * image);
+#endif	// SVE
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions in double precision,
+ *  using AVX512 intrinsics.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ *
+*/
+void mandelbrot_avx512_double(double realBeginning, double realEnd,
+                      double imagBeginning, double imagEnd,
+                      size_t width, size_t height, double * image);
+#endif	// AVX512
+#endif	// SVE
+#endif	// NEON
+
+#endif	// mandelbrotDouble
@@ -0,0 +1,130 @@
+#include <assert.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotEscapeTime.hpp"
+#include "mandelbrotEscapeTimeEngine.hpp"
+#include "mandelbrotRegistry.hpp"
+
+using namespace escape_time;
+
+/* The power of the multibrot set is a template parameter, so the multiplications are unrolled */
+template <class B>
+static HWY_ATTR void multibrot(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int power) {
+    switch (power) {
+        case 2:
+            escapeTime<B>(MultibrotFormula<2>(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+            break;
+        case 3:
+            escapeTime<B>(MultibrotFormula<3>(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+            break;
+        case 4:
+            escapeTime<B>(MultibrotFormula<4>(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+            break;
+        case 5:
+            escapeTime<B>(MultibrotFormula<5>(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+            break;
+        case 6:
+            escapeTime<B>(MultibrotFormula<6>(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+            break;
+        case 7:
+            escapeTime<B>(MultibrotFormula<7>(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+            break;
+        case 8:
+            escapeTime<B>(MultibrotFormula<8>(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+            break;
+        default:
+            assert(false && "The power has to be between 2 and 8");
+    }
+}
+
+
+static void mandelbrot_engine_scalar(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    escapeTime<ScalarBackend>(MandelbrotFormula(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+REGISTER_MANDELBROT_KERNEL(engine_scalar, "engine_scalar", ISA_ANY, mandelbrot_engine_scalar, nullptr, 1);
+
+
+#ifndef NEON
+#ifndef SVE
+void julia_avx2(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image,
+                float cReal, float cImag) {
+    escapeTime<AVX2Backend>(JuliaFormula(cReal, cImag), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+
+void burningShip_avx2(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image) {
+    escapeTime<AVX2Backend>(BurningShipFormula(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+
+void multibrot_avx2(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image,
+                int power) {
+    multibrot<AVX2Backend>(xBegin, xEnd, yBegin, yEnd, width, height, image, power);
+}
+
+static void mandelbrot_engine_avx2(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    escapeTime<AVX2Backend>(MandelbrotFormula(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+REGISTER_MANDELBROT_KERNEL(engine_avx2, "engine_avx2", ISA_AVX2, mandelbrot_engine_avx2, nullptr, 8);
+
+static void mandelbrot_engine_vc(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    escapeTime<VcBackend>(MandelbrotFormula(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+REGISTER_MANDELBROT_KERNEL(engine_vc, "engine_vc", ISA_ANY, mandelbrot_engine_vc, nullptr, Vc::float_v::Size);
+#endif
+#endif
+
+#ifndef SVE
+static void mandelbrot_engine_libsimdpp(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    escapeTime<LibsimdppBackend>(MandelbrotFormula(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+REGISTER_MANDELBROT_KERNEL(engine_libsimdpp, "engine_libsimdpp", ISA_ANY, mandelbrot_engine_libsimdpp, nullptr,
+                      SIMDPP_FAST_FLOAT32_SIZE);
+#endif	// SVE
+
+
+HWY_BEFORE_NAMESPACE();
+HWY_ATTR void julia_highway(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image,
+                float cReal, float cImag) {
+    escapeTime<HighwayBackend>(JuliaFormula(cReal, cImag), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+
+HWY_ATTR void burningShip_highway(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image) {
+    escapeTime<HighwayBackend>(BurningShipFormula(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+
+HWY_ATTR void multibrot_highway(float xBegin, float xEnd,
+                float yBegin, float yEnd,
+                size_t width, size_t height, float * image,
+                int power) {
+    multibrot<HighwayBackend>(xBegin, xEnd, yBegin, yEnd, width, height, image, power);
+}
+
+static HWY_ATTR void mandelbrot_engine_highway(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    escapeTime<HighwayBackend>(MandelbrotFormula(), xBegin, xEnd, yBegin, yEnd, width, height, image);
+}
+HWY_AFTER_NAMESPACE();
+REGISTER_MANDELBROT_KERNEL(engine_highway, "engine_highway", ISA_ANY, mandelbrot_engine_highway, nullptr,
+                      HWY_LANES(float));
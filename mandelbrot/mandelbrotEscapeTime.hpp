@@ -0,0 +1,176 @@
+#ifndef mandelbrotEscapeTime
+#define mandelbrotEscapeTime
+
+#include <stddef.h>
+#include <hwy/highway.h>
+
+/* Kernels of the engine with the mandelbrot signature, the Julia constant and the power of the
+ * multibrot set follow the image. The engine also renders the mandelbrot set itself, these kernels
+ * are registered as engine_scalar, engine_avx2, engine_vc, engine_libsimdpp and engine_highway. */
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the Julia set of the constant c with the given dimensions,
+ *  employing vectorization by using intrinsics through the escape-time engine.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of 8
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param cReal
+ *          The real part of c
+ * @param cImag
+ *          The imaginary part of c
+ *
+*/
+void julia_avx2(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image,
+                float cReal, float cImag);
+
+/**
+ * Calculates the image of the burning ship fractal with the given dimensions,
+ *  employing vectorization by using intrinsics through the escape-time engine.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of 8
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+void burningShip_avx2(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image);
+
+/**
+ * Calculates the image of the multibrot set z^power + c with the given dimensions,
+ *  employing vectorization by using intrinsics through the escape-time engine.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of 8
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param power
+ *          The exponent of z, from 2 to 8
+ *
+*/
+void multibrot_avx2(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image,
+                int power);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Calculates the image of the Julia set of the constant c with the given dimensions,
+ *  employing vectorization by using the Highway library through the escape-time engine.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the vector size
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param cReal
+ *          The real part of c
+ * @param cImag
+ *          The imaginary part of c
+ *
+*/
+HWY_ATTR void julia_highway(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image,
+                float cReal, float cImag);
+
+/**
+ * Calculates the image of the burning ship fractal with the given dimensions,
+ *  employing vectorization by using the Highway library through the escape-time engine.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the vector size
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+HWY_ATTR void burningShip_highway(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image);
+
+/**
+ * Calculates the image of the multibrot set z^power + c with the given dimensions,
+ *  employing vectorization by using the Highway library through the escape-time engine.
+ *
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the vector size
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param power
+ *          The exponent of z, from 2 to 8
+ *
+*/
+HWY_ATTR void multibrot_highway(float realBeginning, float realEnd,
+                float imagBeginning, float imagEnd,
+                size_t width, size_t height, float * image,
+                int power);
+
+#endif
@@ -0,0 +1,291 @@
+#ifndef mandelbrotEscapeTimeEngine
+#define mandelbrotEscapeTimeEngine
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+
+#if !defined(NEON) && !defined(SVE)
+#include <Vc/Vc>
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+#ifndef SVE
+#include <simdpp/simd.h>
+#endif	// SVE
+
+/* Escape-time engine, escapeTime<Backend>(formula, ...) renders any formula with any backend.
+ * Only translation units with the include paths of all libraries can include it, the kernels
+ * built with it are declared in mandelbrotEscapeTime.hpp.
+ *
+ * A backend wraps one vector library behind static functions on its vector type V and mask type M
+ * (set, iota, add, sub, mul, abs, lt, none, select, store). A formula sets up z and c of a pixel
+ * in start and advances z in step, which returns |z|^2 of the value before the step, like the hand
+ * written kernels do. A new fractal only needs a formula, every backend then renders it. Backends
+ * must not keep vectors as data members, the vectors of SVE have no size. */
+
+namespace escape_time {
+
+/* ------------------------------ Backends ------------------------------ */
+
+struct ScalarBackend {
+    typedef float V;
+    typedef bool M;
+
+    static size_t lanes() { return 1; }
+    static V set(float value) { return value; }
+    static V iota(size_t first) { return (float) first; }
+    static V add(V a, V b) { return a + b; }
+    static V sub(V a, V b) { return a - b; }
+    static V mul(V a, V b) { return a * b; }
+    static V abs(V a) { return fabsf(a); }
+    static M lt(V a, V b) { return a < b; }
+    static bool none(M mask) { return !mask; }
+    static V select(M mask, V yes, V no) { return mask ? yes : no; }
+    static void store(V value, float * address) { *address = value; }
+};
+
+#if !defined(NEON) && !defined(SVE)
+struct AVX2Backend {
+    typedef __m256 V;
+    typedef __m256 M;
+
+    static size_t lanes() { return 8; }
+    static V set(float value) { return _mm256_set1_ps(value); }
+    static V iota(size_t first) {
+        return _mm256_add_ps(_mm256_set1_ps(first), _mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0));
+    }
+    static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static V abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static M lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static bool none(M mask) { return _mm256_movemask_ps(mask) == 0; }
+    static V select(M mask, V yes, V no) { return _mm256_blendv_ps(no, yes, mask); }
+    static void store(V value, float * address) { _mm256_storeu_ps(address, value); }
+};
+
+struct VcBackend {
+    typedef Vc::float_v V;
+    typedef Vc::float_m M;
+
+    static size_t lanes() { return V::Size; }
+    static V set(float value) { return V(value); }
+    static V iota(size_t first) { return V::IndexesFromZero() + V((float) first); }
+    static V add(V a, V b) { return a + b; }
+    static V sub(V a, V b) { return a - b; }
+    static V mul(V a, V b) { return a * b; }
+    static V abs(V a) { return Vc::abs(a); }
+    static M lt(V a, V b) { return a < b; }
+    static bool none(M mask) { return mask.isEmpty(); }
+    static V select(M mask, V yes, V no) { return Vc::iif(mask, yes, no); }
+    static void store(V value, float * address) { value.store(address, Vc::Unaligned); }
+};
+#endif  // NEON and SVE
+
+#ifndef SVE
+struct LibsimdppBackend {
+    typedef simdpp::float32<SIMDPP_FAST_FLOAT32_SIZE> V;
+    typedef simdpp::mask_float32<SIMDPP_FAST_FLOAT32_SIZE> M;
+
+    static size_t lanes() { return SIMDPP_FAST_FLOAT32_SIZE; }
+    static V set(float value) { return simdpp::splat(value); }
+    static V iota(size_t first) {
+        float lanes[SIMDPP_FAST_FLOAT32_SIZE];
+        for (size_t k = 0; k < SIMDPP_FAST_FLOAT32_SIZE; k++) {
+            lanes[k] = first + k;
+        }
+        return simdpp::load_u(lanes);
+    }
+    static V add(V a, V b) { return simdpp::add(a, b); }
+    static V sub(V a, V b) { return simdpp::sub(a, b); }
+    static V mul(V a, V b) { return simdpp::mul(a, b); }
+    static V abs(V a) { return simdpp::abs(a); }
+    static M lt(V a, V b) { return simdpp::cmp_lt(a, b); }
+    static bool none(M mask) { return !simdpp::test_bits_any(simdpp::blend(set(1.0f), set(0.0f), mask)); }
+    static V select(M mask, V yes, V no) { return simdpp::blend(yes, no, mask); }
+    static void store(V value, float * address) { simdpp::store_u(address, value); }
+};
+#endif	// SVE
+
+}   // namespace escape_time
+
+HWY_BEFORE_NAMESPACE();
+namespace escape_time {
+
+struct HighwayBackend {
+    typedef hwy::HWY_NAMESPACE::ScalableTag<float> D;
+    typedef hwy::HWY_NAMESPACE::Vec<D> V;
+    typedef hwy::HWY_NAMESPACE::Mask<D> M;
+
+    static HWY_INLINE size_t lanes() { return hwy::HWY_NAMESPACE::Lanes(D()); }
+    static HWY_INLINE V set(float value) { return hwy::HWY_NAMESPACE::Set(D(), value); }
+    static HWY_INLINE V iota(size_t first) { return hwy::HWY_NAMESPACE::Iota(D(), first); }
+    static HWY_INLINE V add(V a, V b) { return hwy::HWY_NAMESPACE::Add(a, b); }
+    static HWY_INLINE V sub(V a, V b) { return hwy::HWY_NAMESPACE::Sub(a, b); }
+    static HWY_INLINE V mul(V a, V b) { return hwy::HWY_NAMESPACE::Mul(a, b); }
+    static HWY_INLINE V abs(V a) { return hwy::HWY_NAMESPACE::Abs(a); }
+    static HWY_INLINE M lt(V a, V b) { return hwy::HWY_NAMESPACE::Lt(a, b); }
+    static HWY_INLINE bool none(M mask) { return hwy::HWY_NAMESPACE::AllFalse(D(), mask); }
+    static HWY_INLINE V select(M mask, V yes, V no) { return hwy::HWY_NAMESPACE::IfThenElse(mask, yes, no); }
+    static HWY_INLINE void store(V value, float * address) { hwy::HWY_NAMESPACE::StoreU(value, D(), address); }
+};
+
+/* ------------------------------ Formulas ------------------------------ */
+
+// z' = z^2 + c with z starting at 0 and c the pixel
+struct MandelbrotFormula {
+    template <class B>
+    HWY_INLINE void start(typename B::V real, typename B::V imag,
+                          typename B::V & z_real, typename B::V & z_imag,
+                          typename B::V & c_real, typename B::V & c_imag) const {
+        z_real = B::set(0.0f);
+        z_imag = B::set(0.0f);
+        c_real = real;
+        c_imag = imag;
+    }
+
+    template <class B>
+    HWY_INLINE typename B::V step(typename B::V & z_real, typename B::V & z_imag,
+                                  typename B::V c_real, typename B::V c_imag) const {
+        typename B::V z_real_squared = B::mul(z_real, z_real);
+        typename B::V z_imag_squared = B::mul(z_imag, z_imag);
+        typename B::V temp = B::mul(z_real, z_imag);
+
+        z_real = B::add(B::sub(z_real_squared, z_imag_squared), c_real);
+        z_imag = B::add(B::add(temp, temp), c_imag);
+        return B::add(z_real_squared, z_imag_squared);
+    }
+};
+
+// z' = z^2 + c with z starting at the pixel and the same c for every pixel
+struct JuliaFormula : MandelbrotFormula {
+    float cReal;
+    float cImag;
+
+    JuliaFormula(float cReal, float cImag) : cReal(cReal), cImag(cImag) {}
+
+    template <class B>
+    HWY_INLINE void start(typename B::V real, typename B::V imag,
+                          typename B::V & z_real, typename B::V & z_imag,
+                          typename B::V & c_real, typename B::V & c_imag) const {
+        z_real = real;
+        z_imag = imag;
+        c_real = B::set(cReal);
+        c_imag = B::set(cImag);
+    }
+};
+
+// z' = (|Re z| + i |Im z|)^2 + c, the mandelbrot iteration on the absolute values of the parts
+struct BurningShipFormula : MandelbrotFormula {
+    template <class B>
+    HWY_INLINE typename B::V step(typename B::V & z_real, typename B::V & z_imag,
+                                  typename B::V c_real, typename B::V c_imag) const {
+        typename B::V z_real_squared = B::mul(z_real, z_real);
+        typename B::V z_imag_squared = B::mul(z_imag, z_imag);
+        typename B::V temp = B::abs(B::mul(z_real, z_imag));
+
+        z_real = B::add(B::sub(z_real_squared, z_imag_squared), c_real);
+        z_imag = B::add(B::add(temp, temp), c_imag);
+        return B::add(z_real_squared, z_imag_squared);
+    }
+};
+
+// z' = z^power + c, the power is unrolled into power - 1 complex multiplications
+template <int power>
+struct MultibrotFormula : MandelbrotFormula {
+    static_assert(power >= 2, "The multibrot set needs a power of at least 2");
+
+    template <class B>
+    HWY_INLINE typename B::V step(typename B::V & z_real, typename B::V & z_imag,
+                                  typename B::V c_real, typename B::V c_imag) const {
+        typename B::V norm = B::add(B::mul(z_real, z_real), B::mul(z_imag, z_imag));
+        typename B::V p_real = z_real;
+        typename B::V p_imag = z_imag;
+        for (int k = 1; k < power; k++) {
+            typename B::V temp = B::sub(B::mul(p_real, z_real), B::mul(p_imag, z_imag));
+            p_imag = B::add(B::mul(p_real, z_imag), B::mul(p_imag, z_real));
+            p_real = temp;
+        }
+
+        z_real = B::add(p_real, c_real);
+        z_imag = B::add(p_imag, c_imag);
+        return norm;
+    }
+};
+
+/* ------------------------------ Engine ------------------------------ */
+
+/**
+ * Calculates the image of an escape-time fractal with the given dimensions, points which stay
+ *  below the bailout value for MAX_ITERATIONS iterations are set to 1, all others to 0.
+ *
+ * @param formula
+ *          The iteration, e.g. MandelbrotFormula or JuliaFormula(-0.8f, 0.156f)
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image, a multiple of the lanes of the backend
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+template <class B, class Formula>
+HWY_INLINE void escapeTime(const Formula & formula,
+                      float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    typedef typename B::V V;
+    typedef typename B::M M;
+    const size_t N = B::lanes();
+
+    assert(width % N == 0); // Ensure that vector lanes fit
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+
+    V xScaleVec = B::set(xScale);
+    V xBeginVec = B::set(xBegin);
+    V bailoutVec = B::set(BAILOUT);
+    V oneVec = B::set(1.0f);
+    V zeroVec = B::set(0.0f);
+
+    for (size_t j = 0; j < height; j++) {
+        V imag = B::set(yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += N) {
+            V real = B::add(B::mul(B::iota(i), xScaleVec), xBeginVec);
+
+            V z_real, z_imag, c_real, c_imag;
+            formula.template start<B>(real, imag, z_real, z_imag, c_real, c_imag);
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+
+                V norm = formula.template step<B>(z_real, z_imag, c_real, c_imag);
+                M mask = B::lt(norm, bailoutVec);
+
+                if (B::none(mask) || iteration > MAX_ITERATIONS) {
+                    B::store(B::select(mask, oneVec, zeroVec), &image[(j * width) + i]);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+}   // namespace escape_time
+HWY_AFTER_NAMESPACE();
+
+#endif
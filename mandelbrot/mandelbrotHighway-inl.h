@@ -0,0 +1,113 @@
+// Included once per Highway target by foreach_target, so it has no ordinary include guard.
+// The toggle guard lets every target compile the code below once.
+#if defined(MANDELBROT_HIGHWAY_INL_H_TARGET) == defined(HWY_TARGET_TOGGLE)
+#ifdef MANDELBROT_HIGHWAY_INL_H_TARGET
+#undef MANDELBROT_HIGHWAY_INL_H_TARGET
+#else
+#define MANDELBROT_HIGHWAY_INL_H_TARGET
+#endif
+
+#include <assert.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotStats.hpp"
+
+/* The Highway mandelbrot kernel, shared by mandelbrot_highway in the static target and
+ * mandelbrot_highway_dispatch, which compiles it for every target. */
+
+HWY_BEFORE_NAMESPACE();
+namespace mandelbrotTargets {
+namespace HWY_NAMESPACE {
+
+template <class D, class V>
+HWY_INLINE auto InsideCardioidOrBulb(D d, V c_real, V c_imag) {
+    using namespace hwy::HWY_NAMESPACE;
+    auto x = Sub(c_real, Set(d, 0.25f));
+    auto c_imag_squared = Mul(c_imag, c_imag);
+    auto q = MulAdd(x, x, c_imag_squared);
+    auto cardioid = Le(Mul(q, Add(q, x)), Mul(Set(d, 0.25f), c_imag_squared));
+    auto bulb_real = Add(c_real, Set(d, 1.0f));
+    auto bulb = Le(MulAdd(bulb_real, bulb_real, c_imag_squared), Set(d, 0.0625f));
+    return Or(cardioid, bulb);
+}
+
+template <bool interiorCheck, int fixedIterations>
+HWY_INLINE void MandelbrotHighwayKernel(float xBegin, float yBegin,
+                      float xScale, float yScale,
+                      size_t xOffset, size_t yOffset,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      int runtimeIterations, float bailout) {
+    // The specialized instantiations get a constant loop bound
+    const int maxIterations = (fixedIterations > 0) ? fixedIterations : runtimeIterations;
+    using namespace hwy::HWY_NAMESPACE;
+
+    const ScalableTag<float> d;
+    const size_t N = Lanes(d);
+    using V = decltype(Zero(d));
+    
+    assert((width * height) % N == 0); // Ensure that vector lanes fit
+
+    auto xScaleVec = Set(d, xScale);
+    auto xBeginVec = Set(d, xBegin); 
+    auto bailoutVec = Set(d, bailout);
+
+    MANDELBROT_STATS_BEGIN(N);
+    for (size_t j = 0; j < height; j++) {
+            auto c_imag = Set(d, yBegin + ((yOffset + j) * yScale));
+        for (size_t i = 0; i < width; i += N) {
+            auto c_real = Iota(d, xOffset + i);
+            c_real = MulAdd(c_real, xScaleVec, xBeginVec);
+
+            auto inside = FirstN(d, 0);
+            if constexpr (interiorCheck) {
+                inside = InsideCardioidOrBulb(d, c_real, c_imag);
+                if (AllTrue(d, inside)) {
+                    Store(Set(d, 1), d, &image[(j * width) + i]);
+                    continue;
+                }
+            }
+
+            V z_real = Zero(d);
+            V z_imag = Zero(d);
+
+            int iteration = 0; 
+            while(1) {
+                iteration++;
+
+                auto z_real_squared = Mul(z_real, z_real); 
+                auto z_imag_squared = Mul(z_imag, z_imag);
+                auto temp = Mul(z_real, z_imag);
+                
+                z_real = Add(Sub(z_real_squared, z_imag_squared), c_real);
+                z_imag = Add(Add(temp, temp), c_imag); 
+
+                /* masking of bailout values */
+                auto norm = Add(z_real_squared, z_imag_squared);
+                auto mask = Lt(norm, bailoutVec);
+                auto active = mask;
+                if constexpr (interiorCheck) {
+                    active = AndNot(inside, mask);
+                    mask = Or(mask, inside);
+                }
+
+                MANDELBROT_STATS_ITERATION(CountTrue(d, active));
+
+                if (iteration > maxIterations || AllFalse(d, active)) {
+                    auto oneVec = Set(d, 1);
+                    auto result = IfThenElseZero(mask, oneVec);
+ 
+                    Store(result, d, &image[(j * width) + i]);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace mandelbrotTargets
+HWY_AFTER_NAMESPACE();
+
+#endif  // MANDELBROT_HIGHWAY_INL_H_TARGET
@@ -0,0 +1,57 @@
+#ifndef mandelbrotInterior
+#define mandelbrotInterior
+
+#if !defined(NEON) && !defined(SVE)
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+/* Points inside the main cardioid or the period-2 bulb never escape. With x = c_real - 1/4 and
+ * q = x^2 + c_imag^2 the point is inside the cardioid if q * (q + x) <= c_imag^2 / 4 and inside
+ * the bulb if (c_real + 1)^2 + c_imag^2 <= 1/16. The helpers are shared by all kernels that
+ * skip the iteration for such points, the Highway one is compiled per target in
+ * mandelbrotHighway-inl.h. */
+
+static inline bool insideCardioidOrBulb(float c_real, float c_imag) {
+    float x = c_real - 0.25f;
+    float q = x * x + c_imag * c_imag;
+    float bulb = (c_real + 1.0f) * (c_real + 1.0f) + c_imag * c_imag;
+    return (q * (q + x) <= 0.25f * c_imag * c_imag) || (bulb <= 0.0625f);
+}
+
+
+#ifndef NEON
+#ifndef SVE
+static inline __m256 insideCardioidOrBulb_avx2(__m256 c_real, __m256 c_imag) {
+    __m256 x = _mm256_sub_ps(c_real, _mm256_set1_ps(0.25f));
+    __m256 c_imag_squared = _mm256_mul_ps(c_imag, c_imag);
+    __m256 q = _mm256_fmadd_ps(x, x, c_imag_squared);
+    __m256 cardioid = _mm256_cmp_ps(_mm256_mul_ps(q, _mm256_add_ps(q, x)),
+                                    _mm256_mul_ps(_mm256_set1_ps(0.25f), c_imag_squared), _CMP_LE_OQ);
+    __m256 bulb_real = _mm256_add_ps(c_real, _mm256_set1_ps(1.0f));
+    __m256 bulb = _mm256_cmp_ps(_mm256_fmadd_ps(bulb_real, bulb_real, c_imag_squared),
+                                _mm256_set1_ps(0.0625f), _CMP_LE_OQ);
+    return _mm256_or_ps(cardioid, bulb);
+}
+#endif	// SVE
+#endif	// NEON
+
+
+#ifndef NEON
+#ifndef SVE
+// Available in every x86 build for the kernels compiled for AVX512 next to the baseline
+__attribute__((target("avx512f")))
+static inline __mmask16 insideCardioidOrBulb_avx512(__m512 c_real, __m512 c_imag) {
+    __m512 x = _mm512_sub_ps(c_real, _mm512_set1_ps(0.25f));
+    __m512 c_imag_squared = _mm512_mul_ps(c_imag, c_imag);
+    __m512 q = _mm512_fmadd_ps(x, x, c_imag_squared);
+    __mmask16 cardioid = _mm512_cmp_ps_mask(_mm512_mul_ps(q, _mm512_add_ps(q, x)),
+                                            _mm512_mul_ps(_mm512_set1_ps(0.25f), c_imag_squared), _CMP_LE_OQ);
+    __m512 bulb_real = _mm512_add_ps(c_real, _mm512_set1_ps(1.0f));
+    __mmask16 bulb = _mm512_cmp_ps_mask(_mm512_fmadd_ps(bulb_real, bulb_real, c_imag_squared),
+                                        _mm512_set1_ps(0.0625f), _CMP_LE_OQ);
+    return cardioid | bulb;
+}
+#endif	// SVE
+#endif	// NEON
+
+#endif	// mandelbrotInterior
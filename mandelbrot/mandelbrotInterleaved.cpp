@@ -0,0 +1,211 @@
+#include <assert.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotInterleaved.hpp"
+
+#if !defined(NEON) && !defined(SVE)
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+/* The kernels iterate a group of adjacent vectors in the same loop, the inner loops over the group
+ * are unrolled so every vector keeps its own registers and the dependency chains overlap. A group
+ * runs until all of its vectors are done, vectors that are done early keep iterating their escaped
+ * lanes, which stay outside of the bailout. */
+
+#ifndef NEON
+#ifndef SVE
+template <int interleave>
+static void mandelbrot_avx2_interleaved_kernel(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int maxIterations, float bailout) {
+    assert(width % (8 * interleave) == 0);
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    __m256 xScaleVec = _mm256_set1_ps(xScale);
+    __m256 xBeginVec = _mm256_set1_ps(xBegin);
+    __m256 bailoutVec = _mm256_set1_ps(bailout);
+    __m256 oneVec = _mm256_set1_ps(1);
+    __m256 zeroVec = _mm256_setzero_ps();
+
+    for (size_t j = 0; j < height; j++) {
+        __m256 c_imag = _mm256_set1_ps (yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += 8 * interleave) {
+            __m256 c_real[interleave];
+            __m256 z_real[interleave];
+            __m256 z_imag[interleave];
+            __m256 mask[interleave];
+
+            #pragma GCC unroll 4
+            for (int k = 0; k < interleave; k++) {
+                size_t x = i + 8 * k;
+                c_real[k] = _mm256_set_ps(8 + x, 7 + x, 6 + x, 5 + x, 4 + x, 3 + x, 2 + x, 1 + x);
+                c_real[k] = _mm256_fmadd_ps(c_real[k], xScaleVec, xBeginVec);
+                z_real[k] = _mm256_setzero_ps();
+                z_imag[k] = _mm256_setzero_ps();
+            }
+
+            int iteration = 0; 
+            while(1) {
+                iteration++; 
+
+                int active = 0;
+                #pragma GCC unroll 4
+                for (int k = 0; k < interleave; k++) {
+                    __m256 z_real_squared = _mm256_mul_ps(z_real[k], z_real[k]);
+                    __m256 z_imag_squared = _mm256_mul_ps(z_imag[k], z_imag[k]); 
+                    __m256 temp = _mm256_mul_ps(z_real[k], z_imag[k]); 
+
+                    z_real[k] = _mm256_add_ps(_mm256_sub_ps(z_real_squared, z_imag_squared), c_real[k]);
+                    z_imag[k] = _mm256_add_ps(_mm256_add_ps(temp, temp), c_imag);
+
+                    __m256 norm = _mm256_add_ps(z_real_squared, z_imag_squared);
+                    mask[k] = _mm256_cmp_ps(norm, bailoutVec, _CMP_LT_OQ);
+                    active |= _mm256_movemask_ps(mask[k]);
+                }
+
+                if (active == 0 || iteration > maxIterations) {
+                    #pragma GCC unroll 4
+                    for (int k = 0; k < interleave; k++) {
+                        __m256 result = _mm256_blendv_ps(zeroVec, oneVec, mask[k]);
+                        _mm256_store_ps(&image[(j * width) + i + 8 * k], result);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void mandelbrot_avx2_interleaved(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int interleave) {
+    mandelbrot_avx2_interleaved(xBegin, xEnd, yBegin, yEnd, width, height, image, interleave, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_avx2_interleaved(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     int interleave, int maxIterations, float bailout) {
+    switch (interleave) {
+        case 1:
+            mandelbrot_avx2_interleaved_kernel<1>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+            break;
+        case 2:
+            mandelbrot_avx2_interleaved_kernel<2>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+            break;
+        case 4:
+            mandelbrot_avx2_interleaved_kernel<4>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+            break;
+        default:
+            assert(!"The interleave factor has to be 1, 2 or 4");
+    }
+}
+#endif	// SVE
+#endif	// NEON
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+template <int interleave>
+static void mandelbrot_avx512_interleaved_kernel(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    assert(width % (16 * interleave) == 0);
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+
+    __m512 xScaleVec  = _mm512_set1_ps(xScale);
+    __m512 xBeginVec = _mm512_set1_ps(xBegin);
+    __m512 bailoutVec = _mm512_set1_ps(bailout);
+    __m512 oneVec = _mm512_set1_ps(1);
+    __m512 zeroVec = _mm512_setzero_ps();
+
+    for (size_t j = 0; j < height; j++) {
+    	__m512 c_imag = _mm512_set1_ps(yBegin + (j * yScale));
+
+        for (size_t i = 0; i < width; i += 16 * interleave) {
+            __m512 c_real[interleave];
+            __m512 z_real[interleave];
+            __m512 z_imag[interleave];
+            __mmask16 mask[interleave];
+
+            #pragma GCC unroll 4
+            for (int k = 0; k < interleave; k++) {
+                size_t x = i + 16 * k;
+                c_real[k] = _mm512_set_ps(16+x, 15+x, 14+x, 13+x, 12+x, 11+x, 10+x, 9+x,
+                    8 + x, 7 + x, 6 + x, 5 + x, 4 + x, 3 + x, 2 + x, 1 + x);
+                c_real[k] = _mm512_fmadd_ps(c_real[k], xScaleVec, xBeginVec);
+                z_real[k] = _mm512_setzero_ps();
+                z_imag[k] = _mm512_setzero_ps();
+            }
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+
+                int active = 0;
+                #pragma GCC unroll 4
+                for (int k = 0; k < interleave; k++) {
+                    __m512 z_real_squared = _mm512_mul_ps(z_real[k], z_real[k]);
+                    __m512 z_imag_squared = _mm512_mul_ps(z_imag[k], z_imag[k]); 
+                    __m512 temp = _mm512_mul_ps(z_real[k], z_imag[k]);
+
+                    z_real[k] = _mm512_add_ps(_mm512_sub_ps(z_real_squared, z_imag_squared), c_real[k]);
+                    z_imag[k] = _mm512_add_ps(_mm512_add_ps(temp, temp), c_imag);
+
+                    __m512 norm = _mm512_add_ps(z_real_squared, z_imag_squared);
+                    mask[k] = _mm512_cmp_ps_mask(norm, bailoutVec, _CMP_LT_OQ);
+                    active |= (int) mask[k];
+                }
+
+                if (active == 0 || iteration > maxIterations) {
+                    #pragma GCC unroll 4
+                    for (int k = 0; k < interleave; k++) {
+                        _mm512_store_ps(&image[(j * width) + i + 16 * k], _mm512_mask_blend_ps(mask[k], zeroVec, oneVec));
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void mandelbrot_avx512_interleaved(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int interleave) {
+    mandelbrot_avx512_interleaved(xBegin, xEnd, yBegin, yEnd, width, height, image, interleave, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_avx512_interleaved(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      int interleave, int maxIterations, float bailout) {
+    switch (interleave) {
+        case 1:
+            mandelbrot_avx512_interleaved_kernel<1>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+            break;
+        case 2:
+            mandelbrot_avx512_interleaved_kernel<2>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+            break;
+        case 4:
+            mandelbrot_avx512_interleaved_kernel<4>(xBegin, xEnd, yBegin, yEnd, width, height, image,
+                      maxIterations, bailout);
+            break;
+        default:
+            assert(!"The interleave factor has to be 1, 2 or 4");
+    }
+}
+#endif // AVX512
+#endif // SVE
+#endif // NEON
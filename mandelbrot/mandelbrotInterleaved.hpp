@@ -0,0 +1,136 @@
+#ifndef mandelbrotInterleaved
+#define mandelbrotInterleaved
+
+#include <stddef.h>
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics. Groups of 1, 2 or 4 adjacent vectors are iterated
+ *  in the same loop to hide the latency of the arithmetic, the width has to be a multiple of 
+ *  8 * interleave.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 32 bytes
+ * @param interleave
+ *          The number of vectors iterated together, 1, 2 or 4
+ * 
+*/
+void mandelbrot_avx2_interleaved(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image,
+                     int interleave);
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions like the variant above,
+ *  the iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 32 bytes
+ * @param interleave
+ *          The number of vectors iterated together, 1, 2 or 4
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_avx2_interleaved(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image,
+                     int interleave, int maxIterations, float bailout);
+#endif	// SVE
+#endif	// NEON
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using AVX512. Groups of 1, 2 or 4 adjacent vectors are iterated
+ *  in the same loop to hide the latency of the arithmetic, the width has to be a multiple of 
+ *  16 * interleave.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ * @param interleave
+ *          The number of vectors iterated together, 1, 2 or 4
+ * 
+*/
+void mandelbrot_avx512_interleaved(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int interleave);
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions like the variant above,
+ *  the iteration cap and the bailout are given at runtime.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ * @param interleave
+ *          The number of vectors iterated together, 1, 2 or 4
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ * 
+*/
+void mandelbrot_avx512_interleaved(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      int interleave, int maxIterations, float bailout);
+#endif  // AVX512
+#endif  // SVE
+#endif 	// NEON
+#endif  // mandelbrotInterleaved
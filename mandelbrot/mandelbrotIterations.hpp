@@ -0,0 +1,272 @@
+#ifndef mandelbrotIterations
+#define mandelbrotIterations
+
+#include <stdint.h>
+#include <hwy/highway.h>
+
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, using auto vectorization. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_autoVec_iterations(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, uint32_t * iterations);
+
+
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, using openMP pragmas to support the auto vectorization. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_openMP_iterations(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      int width, int height, uint32_t * iterations);
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using intrinsics. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_avx2_iterations(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, uint32_t * iterations);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using the Highway library. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_iterations(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      uint32_t* const HWY_RESTRICT iterations);
+
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using the Vc library. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_vc_iterations(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, uint32_t * iterations);
+#endif	// SVE
+#endif	// NEON
+
+
+#ifndef SVE
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using the libsimdpp library. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_libsimdpp_iterations(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, uint32_t * iterations);
+#endif
+
+
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using the pure simd library. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_pure_simd_iterations(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, uint32_t * iterations);
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using AVX512. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_avx512_iterations(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, uint32_t * iterations);
+#endif  // AVX512
+#endif  // SVE
+#endif 	// NEON
+
+
+#ifdef NEON
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using neon extension. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_neon_iterations(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, uint32_t * iterations);
+#endif 	// NEON Implementation
+
+#ifdef SVE 
+/**
+ * Calculates the number of iterations each point of the mandelbrot set with the given dimensions stays 
+ *  below the bailout value, employing vectorization by using sve intrinsics. Points inside the set reach MAX_ITERATIONS + 1.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param iterations
+ *          The array receiving the iteration count of each pixel
+ * 
+*/
+void mandelbrot_sve_iterations(float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, uint32_t * iterations);
+#endif	// SVE
+#endif  // mandelbrotIterations
@@ -0,0 +1,192 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <hwy/highway.h>
+#include <hwy/aligned_allocator.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotPacked.hpp"
+
+#if !defined(NEON) && !defined(SVE)
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+/* The kernels below fill the lanes in reversed order within every group of 8 pixels, so that the
+ * first pixel ends up in the most significant bit and the compare mask can be stored as is. */
+
+#ifndef NEON
+#ifndef SVE
+void mandelbrot_avx2_packed(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, uint8_t * bitmap) {
+    assert(width % 8 == 0);
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    __m256 xScaleVec = _mm256_set1_ps(xScale);
+    __m256 xBeginVec = _mm256_set1_ps(xBegin);
+    __m256 bailoutVec = _mm256_set1_ps(BAILOUT);
+
+    for (size_t j = 0; j < height; j++) {
+        __m256 c_imag = _mm256_set1_ps (yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += 8) {
+            __m256 c_real = _mm256_set_ps(1 + i, 2 + i, 3 + i, 4 + i, 5 + i, 6 + i, 7 + i, 8 + i);
+            c_real = _mm256_fmadd_ps(c_real, xScaleVec, xBeginVec);
+
+            __m256 z_real = _mm256_setzero_ps();
+            __m256 z_imag = _mm256_setzero_ps();
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                __m256 z_real_squared = _mm256_mul_ps(z_real, z_real);
+                __m256 z_imag_squared = _mm256_mul_ps(z_imag, z_imag);
+                __m256 temp = _mm256_mul_ps(z_real, z_imag);
+
+                z_real = _mm256_add_ps(_mm256_sub_ps(z_real_squared, z_imag_squared), c_real);
+                z_imag = _mm256_add_ps(_mm256_add_ps(temp, temp), c_imag);
+
+                __m256 norm = _mm256_add_ps(z_real_squared, z_imag_squared);
+
+                __m256 mask = _mm256_cmp_ps(norm, bailoutVec, _CMP_LT_OQ);
+                int bits = _mm256_movemask_ps(mask);
+
+                if (bits == 0 || iteration > MAX_ITERATIONS) {
+                    bitmap[((j * width) + i) / 8] = (uint8_t) bits;
+                    break;
+                }
+            }
+        }
+    }
+}
+#endif
+#endif
+
+HWY_BEFORE_NAMESPACE();
+HWY_ATTR void mandelbrot_highway_packed(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      uint8_t* const HWY_RESTRICT bitmap) {
+    using namespace hwy;
+    using namespace HWY_NAMESPACE;
+
+    const ScalableTag<float> d;
+    const size_t N = Lanes(d);
+    using V = decltype(Zero(d));
+
+    assert(width % 8 == 0);
+    assert(width % N == 0 || N % 8 == 0); // Ensure that vector lanes fit
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+
+    auto xScaleVec = Set(d, xScale);
+    auto xBeginVec = Set(d, xBegin);
+    auto bailoutVec = Set(d, BAILOUT);
+
+    // Vectors shorter than a byte fill it from the most significant end
+    AlignedFreeUniquePtr<float []> offsets = AllocateAligned<float>(N);
+    for (size_t lane = 0; lane < N; lane++) {
+        offsets[lane] = (N >= 8) ? 8 * (lane / 8) + 7 - (lane % 8) : N - 1 - lane;
+    }
+    auto offsetVec = Load(d, offsets.get());
+
+    for (size_t j = 0; j < height; j++) {
+            auto c_imag = Set(d, yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += N) {
+            auto c_real = Add(Set(d, (float) i), offsetVec);
+            c_real = MulAdd(c_real, xScaleVec, xBeginVec);
+
+            V z_real = Zero(d);
+            V z_imag = Zero(d);
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                auto z_real_squared = Mul(z_real, z_real);
+                auto z_imag_squared = Mul(z_imag, z_imag);
+                auto temp = Mul(z_real, z_imag);
+
+                z_real = Add(Sub(z_real_squared, z_imag_squared), c_real);
+                z_imag = Add(Add(temp, temp), c_imag);
+
+                /* masking of bailout values */
+                auto norm = Add(z_real_squared, z_imag_squared);
+                auto mask = Lt(norm, bailoutVec);
+
+                if (iteration > MAX_ITERATIONS || AllFalse(d, mask)) {
+                    uint8_t * out = &bitmap[((j * width) + i) / 8];
+                    if (N >= 8) {
+                        StoreMaskBits(d, mask, out);
+                    } else {
+                        uint8_t bits;
+                        StoreMaskBits(d, mask, &bits);
+                        if (i % 8 == 0) {
+                            *out = 0;
+                        }
+                        *out |= bits << (8 - N - (i % 8));
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
+HWY_AFTER_NAMESPACE();
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+void mandelbrot_avx512_packed(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, uint8_t * bitmap) {
+    assert(width % 16 == 0);
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+
+    __m512 xScaleVec  = _mm512_set1_ps(xScale);
+    __m512 xBeginVec = _mm512_set1_ps(xBegin);
+    __m512 bailoutVec = _mm512_set1_ps(BAILOUT);
+
+    for (size_t j = 0; j < height; j++) {
+    	__m512 c_imag = _mm512_set1_ps(yBegin + (j * yScale));
+
+        for (size_t i = 0; i < width; i += 16) {
+            __m512 c_real = _mm512_set_ps(9+i, 10+i, 11+i, 12+i, 13+i, 14+i, 15+i, 16+i,
+                1 + i, 2 + i, 3 + i, 4 + i, 5 + i, 6 + i, 7 + i, 8 + i);
+            c_real = _mm512_fmadd_ps(c_real, xScaleVec, xBeginVec);
+
+            __m512 z_real = _mm512_setzero_ps();
+            __m512 z_imag = _mm512_setzero_ps();
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+
+                __m512 z_real_squared = _mm512_mul_ps(z_real, z_real);
+                __m512 z_imag_squared = _mm512_mul_ps(z_imag, z_imag);
+                __m512 temp = _mm512_mul_ps(z_real, z_imag);
+
+                z_real = _mm512_add_ps(_mm512_sub_ps(z_real_squared, z_imag_squared), c_real);
+                z_imag = _mm512_add_ps(_mm512_add_ps(temp, temp), c_imag);
+
+                __m512 norm = _mm512_add_ps(z_real_squared, z_imag_squared);
+
+                __mmask16 mask = _mm512_cmp_ps_mask(norm, bailoutVec, _CMP_LT_OQ);
+
+                if ((int) mask  == 0 || iteration > MAX_ITERATIONS) {
+                    // The low byte of the mask holds the first 8 pixels
+                    uint16_t bits = (uint16_t) mask;
+                    memcpy(&bitmap[((j * width) + i) / 8], &bits, sizeof(bits));
+                    break;
+                }
+            }
+        }
+    }
+}
+#endif // AVX512
+#endif // SVE
+#endif // NEON
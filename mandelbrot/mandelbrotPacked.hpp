@@ -0,0 +1,97 @@
+#ifndef mandelbrotPacked
+#define mandelbrotPacked
+
+#include <stdint.h>
+#include <hwy/highway.h>
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics.
+ *  The image is stored with one bit per pixel, rows are packed into bytes starting with 
+ *  the most significant bit (the layout of a binary PBM image). The width has to be a multiple of 8.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param bitmap
+ *          The packed image array of width * height / 8 bytes
+ * 
+*/
+void mandelbrot_avx2_packed(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, uint8_t * bitmap);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library.
+ *  The image is stored with one bit per pixel, rows are packed into bytes starting with 
+ *  the most significant bit (the layout of a binary PBM image). The width has to be a multiple of 8.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param bitmap
+ *          The packed image array of width * height / 8 bytes
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_packed(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      uint8_t* const HWY_RESTRICT bitmap);
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using AVX512.
+ *  The image is stored with one bit per pixel, rows are packed into bytes starting with 
+ *  the most significant bit (the layout of a binary PBM image). The width has to be a multiple of 8.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param bitmap
+ *          The packed image array of width * height / 8 bytes
+ * 
+*/
+void mandelbrot_avx512_packed(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, uint8_t * bitmap);
+#endif  // AVX512
+#endif  // SVE
+#endif 	// NEON
+#endif  // mandelbrotPacked
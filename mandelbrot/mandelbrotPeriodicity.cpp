@@ -0,0 +1,254 @@
+#include <assert.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotPeriodicity.hpp"
+#include "mandelbrotInterior.hpp"
+#include "mandelbrotHighway-inl.h"
+
+#if !defined(NEON) && !defined(SVE)
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+/* All lanes of a vector share the iteration counter, so the checkpoints of Brent's algorithm are
+ * the same for every lane and only the comparison has to be vectorized. Lanes inside the main
+ * cardioid or the period-2 bulb start out as retired. */
+
+#ifndef NEON
+#ifndef SVE
+void mandelbrot_avx2_periodicity(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * image,
+                     float tolerance) {
+    assert((width * height) % 8 == 0);
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+    __m256 xScaleVec = _mm256_set1_ps(xScale);
+    __m256 xBeginVec = _mm256_set1_ps(xBegin);
+    __m256 bailoutVec = _mm256_set1_ps(BAILOUT);
+    __m256 toleranceVec = _mm256_set1_ps(tolerance * tolerance);
+    __m256 oneVec = _mm256_set1_ps(1);
+    __m256 zeroVec = _mm256_setzero_ps();
+
+    for (size_t j = 0; j < height; j++) {
+        __m256 c_imag = _mm256_set1_ps (yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += 8) {
+            __m256 c_real = _mm256_set_ps(8 + i, 7 + i, 6 + i, 5 + i, 4 + i, 3 + i, 2 + i, 1 + i);
+            c_real = _mm256_fmadd_ps(c_real, xScaleVec, xBeginVec);
+
+            __m256 retired = insideCardioidOrBulb_avx2(c_real, c_imag);
+            if (_mm256_movemask_ps(retired) == 0xFF) {
+                _mm256_store_ps(&image[(j * width) + i], oneVec);
+                continue;
+            }
+
+            __m256 z_real = _mm256_setzero_ps();
+            __m256 z_imag = _mm256_setzero_ps();
+            __m256 saved_real = _mm256_setzero_ps();
+            __m256 saved_imag = _mm256_setzero_ps();
+
+            int iteration = 0; 
+            int checkpoint = 1;
+            while(1) {
+                iteration++; 
+
+                __m256 z_real_squared = _mm256_mul_ps(z_real, z_real);
+                __m256 z_imag_squared = _mm256_mul_ps(z_imag, z_imag); 
+                __m256 temp = _mm256_mul_ps(z_real, z_imag); 
+
+                z_real = _mm256_add_ps(_mm256_sub_ps(z_real_squared, z_imag_squared), c_real);
+                z_imag = _mm256_add_ps(_mm256_add_ps(temp, temp), c_imag);
+
+                __m256 norm = _mm256_add_ps(z_real_squared, z_imag_squared);
+                __m256 mask = _mm256_cmp_ps(norm, bailoutVec, _CMP_LT_OQ);
+
+                // Retire lanes whose z came back to the value saved at the last checkpoint
+                __m256 delta_real = _mm256_sub_ps(z_real, saved_real);
+                __m256 delta_imag = _mm256_sub_ps(z_imag, saved_imag);
+                __m256 delta = _mm256_fmadd_ps(delta_real, delta_real, _mm256_mul_ps(delta_imag, delta_imag));
+                retired = _mm256_or_ps(retired, _mm256_and_ps(mask, _mm256_cmp_ps(delta, toleranceVec, _CMP_LT_OQ)));
+
+                __m256 active = _mm256_andnot_ps(retired, mask);
+                mask = _mm256_or_ps(mask, retired);
+
+                if (_mm256_movemask_ps(active) == 0 || iteration > MAX_ITERATIONS) {
+                    __m256 result = _mm256_blendv_ps(zeroVec, oneVec, mask);
+                    _mm256_store_ps(&image[(j * width) + i], result);
+                    break;
+                }
+
+                if (iteration == checkpoint) {
+                    saved_real = z_real;
+                    saved_imag = z_imag;
+                    checkpoint *= 2;
+                }
+            }
+        }
+    }
+}
+#endif
+#endif
+
+
+HWY_BEFORE_NAMESPACE();
+HWY_ATTR void mandelbrot_highway_periodicity(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      float tolerance) {
+    using namespace hwy; 
+    using namespace HWY_NAMESPACE;
+
+    const ScalableTag<float> d;
+    const size_t N = Lanes(d);
+    using V = decltype(Zero(d));
+    
+    assert((width * height) % N == 0); // Ensure that vector lanes fit
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+
+    auto xScaleVec = Set(d, xScale);
+    auto xBeginVec = Set(d, xBegin); 
+    auto bailoutVec = Set(d, BAILOUT);
+    auto toleranceVec = Set(d, tolerance * tolerance);
+    auto oneVec = Set(d, 1);
+
+    for (size_t j = 0; j < height; j++) {
+            auto c_imag = Set(d, yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += N) {
+            auto c_real = Iota(d, i);
+            c_real = MulAdd(c_real, xScaleVec, xBeginVec);
+
+            auto retired = mandelbrotTargets::HWY_NAMESPACE::InsideCardioidOrBulb(d, c_real, c_imag);
+            if (AllTrue(d, retired)) {
+                Store(oneVec, d, &image[(j * width) + i]);
+                continue;
+            }
+
+            V z_real = Zero(d);
+            V z_imag = Zero(d);
+            V saved_real = Zero(d);
+            V saved_imag = Zero(d);
+
+            int iteration = 0; 
+            int checkpoint = 1;
+            while(1) {
+                iteration++;
+
+                auto z_real_squared = Mul(z_real, z_real); 
+                auto z_imag_squared = Mul(z_imag, z_imag);
+                auto temp = Mul(z_real, z_imag);
+                
+                z_real = Add(Sub(z_real_squared, z_imag_squared), c_real);
+                z_imag = Add(Add(temp, temp), c_imag); 
+
+                /* masking of bailout values */
+                auto norm = Add(z_real_squared, z_imag_squared);
+                auto mask = Lt(norm, bailoutVec);
+
+                // Retire lanes whose z came back to the value saved at the last checkpoint
+                auto delta_real = Sub(z_real, saved_real);
+                auto delta_imag = Sub(z_imag, saved_imag);
+                auto delta = MulAdd(delta_real, delta_real, Mul(delta_imag, delta_imag));
+                retired = Or(retired, And(mask, Lt(delta, toleranceVec)));
+
+                auto active = AndNot(retired, mask);
+                mask = Or(mask, retired);
+
+                if (iteration > MAX_ITERATIONS || AllFalse(d, active)) {
+                    Store(IfThenElseZero(mask, oneVec), d, &image[(j * width) + i]);
+                    break;
+                }
+
+                if (iteration == checkpoint) {
+                    saved_real = z_real;
+                    saved_imag = z_imag;
+                    checkpoint *= 2;
+                }
+            }
+        }
+    }
+}
+HWY_AFTER_NAMESPACE();
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+void mandelbrot_avx512_periodicity(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      float tolerance) {
+    assert((width * height) % 16 == 0);
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+
+    __m512 xScaleVec  = _mm512_set1_ps(xScale);
+    __m512 xBeginVec = _mm512_set1_ps(xBegin);
+    __m512 bailoutVec = _mm512_set1_ps(BAILOUT);
+    __m512 toleranceVec = _mm512_set1_ps(tolerance * tolerance);
+    __m512 oneVec = _mm512_set1_ps(1);
+    __m512 zeroVec = _mm512_setzero_ps();
+
+    for (size_t j = 0; j < height; j++) {
+    	__m512 c_imag = _mm512_set1_ps(yBegin + (j * yScale));
+
+        for (size_t i = 0; i < width; i += 16) {
+            __m512 c_real = _mm512_set_ps(16+i, 15+i, 14+i, 13+i, 12+i, 11+i, 10+i, 9+i,
+                8 + i, 7 + i, 6 + i, 5 + i, 4 + i, 3 + i, 2 + i, 1 + i);
+            c_real = _mm512_fmadd_ps(c_real, xScaleVec, xBeginVec);
+
+            __mmask16 retired = insideCardioidOrBulb_avx512(c_real, c_imag);
+            if (retired == 0xFFFF) {
+                _mm512_store_ps(&image[(j * width) + i], oneVec);
+                continue;
+            }
+
+            __m512 z_real = _mm512_setzero_ps();
+            __m512 z_imag = _mm512_setzero_ps();
+            __m512 saved_real = _mm512_setzero_ps();
+            __m512 saved_imag = _mm512_setzero_ps();
+
+            int iteration = 0;
+            int checkpoint = 1;
+            while (1) {
+                iteration++;
+
+                __m512 z_real_squared = _mm512_mul_ps(z_real, z_real);
+                __m512 z_imag_squared = _mm512_mul_ps(z_imag, z_imag); 
+                __m512 temp = _mm512_mul_ps(z_real, z_imag);
+
+                z_real = _mm512_add_ps(_mm512_sub_ps(z_real_squared, z_imag_squared), c_real);
+                z_imag = _mm512_add_ps(_mm512_add_ps(temp, temp), c_imag);
+
+                __m512 norm = _mm512_add_ps(z_real_squared, z_imag_squared);
+                __mmask16 mask = _mm512_cmp_ps_mask(norm, bailoutVec, _CMP_LT_OQ);
+
+                // Retire lanes whose z came back to the value saved at the last checkpoint
+                __m512 delta_real = _mm512_sub_ps(z_real, saved_real);
+                __m512 delta_imag = _mm512_sub_ps(z_imag, saved_imag);
+                __m512 delta = _mm512_fmadd_ps(delta_real, delta_real, _mm512_mul_ps(delta_imag, delta_imag));
+                retired |= _mm512_mask_cmp_ps_mask(mask, delta, toleranceVec, _CMP_LT_OQ);
+
+                __mmask16 active = mask & ~retired;
+                mask |= retired;
+
+                if ((int) active == 0 || iteration > MAX_ITERATIONS) {
+                    _mm512_store_ps(&image[(j * width) + i], _mm512_mask_blend_ps(mask, zeroVec, oneVec));
+                    break;
+                }
+
+                if (iteration == checkpoint) {
+                    saved_real = z_real;
+                    saved_imag = z_imag;
+                    checkpoint *= 2;
+                }
+            }
+        }
+    }
+}
+#endif // AVX512
+#endif // SVE
+#endif // NEON
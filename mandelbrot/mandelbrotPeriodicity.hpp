@@ -0,0 +1,109 @@
+#ifndef mandelbrotPeriodicity
+#define mandelbrotPeriodicity
+
+#include <stddef.h>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+
+/* Kernels with periodicity detection after Brent. Every lane saves its z at the iterations 1, 2,
+ * 4, 8, ... and compares the following values against it. Once z comes back within the tolerance
+ * of the saved value, the orbit has settled into a cycle, the lane is retired as part of the set.
+ * Together with the cardioid and bulb test of the _interiorCheck kernels, interior points then
+ * stop long before MAX_ITERATIONS. A larger tolerance retires lanes earlier but may mark slowly escaping points
+ * close to the boarder as inside. */
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics and retiring periodic lanes early.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 32 bytes
+ * @param tolerance
+ *          The distance below which two values of z are considered equal
+ * 
+*/
+void mandelbrot_avx2_periodicity(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * image,
+                     float tolerance = PERIODICITY_TOLERANCE);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library and retiring periodic lanes early.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to the vector size
+ * @param tolerance
+ *          The distance below which two values of z are considered equal
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_periodicity(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT image,
+                      float tolerance = PERIODICITY_TOLERANCE);
+
+
+#ifndef NEON
+#ifndef SVE
+#ifdef AVX512
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using AVX512 and retiring periodic lanes early.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param image
+ *          The immage array, aligned to 64 bytes
+ * @param tolerance
+ *          The distance below which two values of z are considered equal
+ * 
+*/
+void mandelbrot_avx512_periodicity(float realBeginning, float realEnd, 
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      float tolerance = PERIODICITY_TOLERANCE);
+#endif  // AVX512
+#endif  // SVE
+#endif 	// NEON
+#endif  // mandelbrotPeriodicity
@@ -0,0 +1,291 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+#include <hwy/highway.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotPerturbation.hpp"
+
+#if !defined(NEON) && !defined(SVE)
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+/* Double-double arithmetic after Dekker and Knuth. The error terms rely on exact IEEE rounding,
+ * so this file must not be compiled with -ffast-math. */
+
+static inline DoubleDouble quickTwoSum(double a, double b) {
+    double s = a + b;
+    return DoubleDouble(s, b - (s - a));
+}
+
+static inline DoubleDouble twoSum(double a, double b) {
+    double s = a + b;
+    double bb = s - a;
+    return DoubleDouble(s, (a - (s - bb)) + (b - bb));
+}
+
+static inline DoubleDouble twoProd(double a, double b) {
+    double p = a * b;
+    return DoubleDouble(p, fma(a, b, -p));
+}
+
+static inline DoubleDouble add(DoubleDouble a, DoubleDouble b) {
+    DoubleDouble s = twoSum(a.hi, b.hi);
+    DoubleDouble t = twoSum(a.lo, b.lo);
+    s = quickTwoSum(s.hi, s.lo + t.hi);
+    return quickTwoSum(s.hi, s.lo + t.lo);
+}
+
+static inline DoubleDouble negate(DoubleDouble a) {
+    return DoubleDouble(-a.hi, -a.lo);
+}
+
+static inline DoubleDouble mul(DoubleDouble a, DoubleDouble b) {
+    DoubleDouble p = twoProd(a.hi, b.hi);
+    return quickTwoSum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+
+static inline DoubleDouble mul(DoubleDouble a, double b) {
+    DoubleDouble p = twoProd(a.hi, b);
+    return quickTwoSum(p.hi, p.lo + a.lo * b);
+}
+
+static inline DoubleDouble div(DoubleDouble a, double b) {
+    double q1 = a.hi / b;
+    DoubleDouble r = add(a, negate(twoProd(q1, b)));
+    double q2 = r.hi / b;
+    r = add(r, negate(twoProd(q2, b)));
+    return add(quickTwoSum(q1, q2), DoubleDouble(r.hi / b));
+}
+
+
+DoubleDouble parseDoubleDouble(const char * text) {
+    bool negative = false;
+    if (*text == '-' || *text == '+') {
+        negative = (*text == '-');
+        text++;
+    }
+
+    DoubleDouble value;
+    int exponent = 0;
+    bool fraction = false;
+    for (; *text != '\0'; text++) {
+        if (*text == '.') {
+            fraction = true;
+        } else if (*text >= '0' && *text <= '9') {
+            value = add(mul(value, 10.0), DoubleDouble(*text - '0'));
+            exponent -= fraction;
+        } else {
+            if (*text == 'e' || *text == 'E') {
+                exponent += atoi(text + 1);
+            }
+            break;
+        }
+    }
+
+    for (; exponent < 0; exponent++) {
+        value = div(value, 10.0);
+    }
+    for (; exponent > 0; exponent--) {
+        value = mul(value, 10.0);
+    }
+    return negative ? negate(value) : value;
+}
+
+
+size_t computeReferenceOrbit(DoubleDouble cReal, DoubleDouble cImag,
+                      double * orbitReal, double * orbitImag, size_t maxLength) {
+    DoubleDouble z_real;
+    DoubleDouble z_imag;
+
+    size_t length = 0;
+    while (length < maxLength) {
+        orbitReal[length] = z_real.hi;
+        orbitImag[length] = z_imag.hi;
+        length++;
+
+        if (z_real.hi * z_real.hi + z_imag.hi * z_imag.hi > BAILOUT) {
+            break;
+        }
+
+        DoubleDouble temp = mul(z_real, z_imag);
+        z_real = add(add(mul(z_real, z_real), negate(mul(z_imag, z_imag))), cReal);
+        z_imag = add(add(temp, temp), cImag);
+    }
+    return length;
+}
+
+
+#ifndef NEON
+#ifndef SVE
+void mandelbrot_perturbation_avx2(DoubleDouble xCenter, DoubleDouble yCenter, double radius,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_perturbation_avx2(xCenter, yCenter, radius, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+void mandelbrot_perturbation_avx2(DoubleDouble xCenter, DoubleDouble yCenter, double radius,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout) {
+    assert(width % 4 == 0);
+
+    // Index maxIterations is the last one a pixel can reach before it is stored
+    std::vector<double> orbitReal(maxIterations + 1);
+    std::vector<double> orbitImag(maxIterations + 1);
+    size_t orbitLength = computeReferenceOrbit(xCenter, yCenter, orbitReal.data(), orbitImag.data(), orbitReal.size());
+
+    double scale = 2 * radius / width;
+    double yRadius = scale * height / 2;
+
+    __m256d scaleVec = _mm256_set1_pd(scale);
+    __m256d xOffsetVec = _mm256_set1_pd(-radius);
+    __m256d bailoutVec = _mm256_set1_pd(bailout);
+    __m256d oneVec = _mm256_set1_pd(1);
+    __m256d zeroVec = _mm256_setzero_pd();
+    __m256i lastIndexVec = _mm256_set1_epi64x(orbitLength - 1);
+    __m256i oneIndexVec = _mm256_set1_epi64x(1);
+
+    for (size_t j = 0; j < height; j++) {
+        __m256d dc_imag = _mm256_set1_pd(j * scale - yRadius);
+        for (size_t i = 0; i < width; i += 4) {
+            __m256d dc_real = _mm256_set_pd(3 + i, 2 + i, 1 + i, i);
+            dc_real = _mm256_fmadd_pd(dc_real, scaleVec, xOffsetVec);
+
+            __m256d dz_real = _mm256_setzero_pd();
+            __m256d dz_imag = _mm256_setzero_pd();
+            __m256i n = _mm256_setzero_si256();
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+
+                __m256d Z_real = _mm256_i64gather_pd(orbitReal.data(), n, 8);
+                __m256d Z_imag = _mm256_i64gather_pd(orbitImag.data(), n, 8);
+
+                __m256d z_real = _mm256_add_pd(Z_real, dz_real);
+                __m256d z_imag = _mm256_add_pd(Z_imag, dz_imag);
+                __m256d norm = _mm256_add_pd(_mm256_mul_pd(z_real, z_real), _mm256_mul_pd(z_imag, z_imag));
+
+                __m256d mask = _mm256_cmp_pd(norm, bailoutVec, _CMP_LT_OQ);
+
+                if (_mm256_movemask_pd(mask) == 0 || iteration > maxIterations) {
+                    __m256d result = _mm256_blendv_pd(zeroVec, oneVec, mask);
+                    _mm_storeu_ps(&image[(j * width) + i], _mm256_cvtpd_ps(result));
+                    break;
+                }
+
+                // Rebase glitched lanes and lanes at the end of the reference orbit, Z_0 is zero
+                __m256d dz_norm = _mm256_add_pd(_mm256_mul_pd(dz_real, dz_real), _mm256_mul_pd(dz_imag, dz_imag));
+                __m256d rebase = _mm256_or_pd(_mm256_cmp_pd(norm, dz_norm, _CMP_LT_OQ),
+                                              _mm256_castsi256_pd(_mm256_cmpeq_epi64(n, lastIndexVec)));
+
+                dz_real = _mm256_blendv_pd(dz_real, z_real, rebase);
+                dz_imag = _mm256_blendv_pd(dz_imag, z_imag, rebase);
+                Z_real = _mm256_andnot_pd(rebase, Z_real);
+                Z_imag = _mm256_andnot_pd(rebase, Z_imag);
+                n = _mm256_andnot_si256(_mm256_castpd_si256(rebase), n);
+
+                // dz' = (2Z + dz) * dz + dc, split into real and imaginary part
+                __m256d temp_real = _mm256_add_pd(_mm256_add_pd(Z_real, Z_real), dz_real);
+                __m256d temp_imag = _mm256_add_pd(_mm256_add_pd(Z_imag, Z_imag), dz_imag);
+                __m256d new_real = _mm256_fmsub_pd(temp_real, dz_real, _mm256_mul_pd(temp_imag, dz_imag));
+                __m256d new_imag = _mm256_fmadd_pd(temp_real, dz_imag, _mm256_mul_pd(temp_imag, dz_real));
+
+                dz_real = _mm256_add_pd(new_real, dc_real);
+                dz_imag = _mm256_add_pd(new_imag, dc_imag);
+                n = _mm256_add_epi64(n, oneIndexVec);
+            }
+        }
+    }
+}
+#endif	// SVE
+#endif	// NEON
+
+
+HWY_BEFORE_NAMESPACE();
+HWY_ATTR void mandelbrot_perturbation_highway(DoubleDouble xCenter, DoubleDouble yCenter, double radius,
+                      size_t width, size_t height, float* const HWY_RESTRICT image) {
+    mandelbrot_perturbation_highway(xCenter, yCenter, radius, width, height, image, MAX_ITERATIONS, BAILOUT);
+}
+
+HWY_ATTR void mandelbrot_perturbation_highway(DoubleDouble xCenter, DoubleDouble yCenter, double radius,
+                      size_t width, size_t height, float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout) {
+    using namespace hwy;
+    using namespace HWY_NAMESPACE;
+
+    const ScalableTag<double> d;
+    const RebindToSigned<decltype(d)> di;
+    const Rebind<float, decltype(d)> df;
+    const size_t N = Lanes(d);
+    using V = decltype(Zero(d));
+
+    assert(width % N == 0); // Ensure that vector lanes fit
+
+    // Index maxIterations is the last one a pixel can reach before it is stored
+    std::vector<double> orbitReal(maxIterations + 1);
+    std::vector<double> orbitImag(maxIterations + 1);
+    size_t orbitLength = computeReferenceOrbit(xCenter, yCenter, orbitReal.data(), orbitImag.data(), orbitReal.size());
+
+    double scale = 2 * radius / width;
+    double yRadius = scale * height / 2;
+
+    auto scaleVec = Set(d, scale);
+    auto xOffsetVec = Set(d, -radius);
+    auto bailoutVec = Set(d, (double) bailout);
+    auto oneVec = Set(d, 1.0);
+    auto lastIndexVec = Set(di, (int64_t) orbitLength - 1);
+    auto oneIndexVec = Set(di, 1);
+
+    for (size_t j = 0; j < height; j++) {
+        auto dc_imag = Set(d, j * scale - yRadius);
+        for (size_t i = 0; i < width; i += N) {
+            auto dc_real = MulAdd(Iota(d, i), scaleVec, xOffsetVec);
+
+            V dz_real = Zero(d);
+            V dz_imag = Zero(d);
+            auto n = Zero(di);
+
+            int iteration = 0;
+            while (1) {
+                iteration++;
+
+                V Z_real = GatherIndex(d, orbitReal.data(), n);
+                V Z_imag = GatherIndex(d, orbitImag.data(), n);
+
+                auto z_real = Add(Z_real, dz_real);
+                auto z_imag = Add(Z_imag, dz_imag);
+                auto norm = Add(Mul(z_real, z_real), Mul(z_imag, z_imag));
+
+                auto mask = Lt(norm, bailoutVec);
+
+                if (iteration > maxIterations || AllFalse(d, mask)) {
+                    StoreU(DemoteTo(df, IfThenElseZero(mask, oneVec)), df, &image[(j * width) + i]);
+                    break;
+                }
+
+                // Rebase glitched lanes and lanes at the end of the reference orbit, Z_0 is zero
+                auto dz_norm = Add(Mul(dz_real, dz_real), Mul(dz_imag, dz_imag));
+                auto rebase = Or(Lt(norm, dz_norm), RebindMask(d, Eq(n, lastIndexVec)));
+
+                dz_real = IfThenElse(rebase, z_real, dz_real);
+                dz_imag = IfThenElse(rebase, z_imag, dz_imag);
+                Z_real = IfThenZeroElse(rebase, Z_real);
+                Z_imag = IfThenZeroElse(rebase, Z_imag);
+                n = IfThenZeroElse(RebindMask(di, rebase), n);
+
+                // dz' = (2Z + dz) * dz + dc, split into real and imaginary part
+                auto temp_real = Add(Add(Z_real, Z_real), dz_real);
+                auto temp_imag = Add(Add(Z_imag, Z_imag), dz_imag);
+                auto new_real = MulSub(temp_real, dz_real, Mul(temp_imag, dz_imag));
+                auto new_imag = MulAdd(temp_real, dz_imag, Mul(temp_imag, dz_real));
+
+                dz_real = Add(new_real, dc_real);
+                dz_imag = Add(new_imag, dc_imag);
+                n = Add(n, oneIndexVec);
+            }
+        }
+    }
+}
+HWY_AFTER_NAMESPACE();
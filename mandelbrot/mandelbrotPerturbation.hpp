@@ -0,0 +1,160 @@
+#ifndef mandelbrotPerturbation
+#define mandelbrotPerturbation
+
+#include <stddef.h>
+#include <hwy/highway.h>
+
+/* Deep zoom rendering with perturbation theory. One reference orbit Z is computed for the center
+ * of the viewport in double-double precision, every pixel c = C + dc then only iterates its small
+ * delta dz in double precision:
+ *
+ *      dz' = 2 * Z * dz + dz^2 + dc
+ *
+ * The delta becomes inaccurate once the full value Z + dz gets smaller than dz itself (a glitch).
+ * Such lanes are rebased: dz is set to the full value and continues from the start of the orbit. */
+
+/**
+ * Software extended precision number with about 32 significant decimal digits, the value is hi + lo.
+*/
+struct DoubleDouble {
+    double hi;
+    double lo;
+
+    DoubleDouble() : hi(0.0), lo(0.0) {}
+    DoubleDouble(double value) : hi(value), lo(0.0) {}
+    DoubleDouble(double hi, double lo) : hi(hi), lo(lo) {}
+};
+
+/**
+ * Parses a decimal number like "-1.7693831791955150182138472860854737829057" in double-double
+ *  precision.
+ *
+ * @param text
+ *          The number, optionally with sign and exponent
+ *
+ * @return  The parsed number
+*/
+DoubleDouble parseDoubleDouble(const char * text);
+
+/**
+ * Computes the reference orbit Z_0 = 0, Z_n+1 = Z_n^2 + C in double-double precision,
+ *  rounding every point to double. The orbit ends after the first point beyond the bailout.
+ *
+ * @param cReal
+ *          The real part of the reference point C
+ * @param cImag
+ *          The imaginary part of the reference point C
+ * @param orbitReal
+ *          The array receiving the real parts of the orbit
+ * @param orbitImag
+ *          The array receiving the imaginary parts of the orbit
+ * @param maxLength
+ *          The capacity of the orbit arrays
+ *
+ * @return  The number of points of the orbit
+*/
+size_t computeReferenceOrbit(DoubleDouble cReal, DoubleDouble cImag,
+                      double * orbitReal, double * orbitImag, size_t maxLength);
+
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the image of the mandelbrot set around the given center using perturbation theory
+ *  and AVX2 intrinsics.
+ *
+ * @param realCenter
+ *          The x value of the center of the image
+ * @param imagCenter
+ *          The y value of the center of the image
+ * @param radius
+ *          Half of the width of the image, pixels are square
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+void mandelbrot_perturbation_avx2(DoubleDouble realCenter, DoubleDouble imagCenter, double radius,
+                      size_t width, size_t height, float * image);
+
+/**
+ * Calculates the image of the mandelbrot set around the given center using perturbation theory
+ *  and AVX2 intrinsics. The iteration cap and the bailout are given at runtime, deep zooms need
+ *  far more iterations than MAX_ITERATIONS.
+ *
+ * @param realCenter
+ *          The x value of the center of the image
+ * @param imagCenter
+ *          The y value of the center of the image
+ * @param radius
+ *          Half of the width of the image, pixels are square
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ *
+*/
+void mandelbrot_perturbation_avx2(DoubleDouble realCenter, DoubleDouble imagCenter, double radius,
+                      size_t width, size_t height, float * image,
+                      int maxIterations, float bailout);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Calculates the image of the mandelbrot set around the given center using perturbation theory
+ *  and Google Highway.
+ *
+ * @param realCenter
+ *          The x value of the center of the image
+ * @param imagCenter
+ *          The y value of the center of the image
+ * @param radius
+ *          Half of the width of the image, pixels are square
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+*/
+HWY_ATTR void mandelbrot_perturbation_highway(DoubleDouble realCenter, DoubleDouble imagCenter, double radius,
+                      size_t width, size_t height, float* const HWY_RESTRICT image);
+
+/**
+ * Calculates the image of the mandelbrot set around the given center using perturbation theory
+ *  and Google Highway. The iteration cap and the bailout are given at runtime.
+ *
+ * @param realCenter
+ *          The x value of the center of the image
+ * @param imagCenter
+ *          The y value of the center of the image
+ * @param radius
+ *          Half of the width of the image, pixels are square
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param maxIterations
+ *          The maximum number of iterations per number tested
+ * @param bailout
+ *          The squared absolute value beyond which a number escapes
+ *
+*/
+HWY_ATTR void mandelbrot_perturbation_highway(DoubleDouble realCenter, DoubleDouble imagCenter, double radius,
+                      size_t width, size_t height, float* const HWY_RESTRICT image,
+                      int maxIterations, float bailout);
+
+#endif	// mandelbrotPerturbation
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <string.h>
+
+#include "mandelbrotRegistry.hpp"
+
+// Constructed on first use, the registrars of other translation units may run before this one
+static std::vector<MandelbrotKernelInfo> & registry() {
+    static std::vector<MandelbrotKernelInfo> kernels;
+    return kernels;
+}
+
+MandelbrotKernelRegistrar::MandelbrotKernelRegistrar(const MandelbrotKernelInfo & info) {
+    std::vector<MandelbrotKernelInfo> & kernels = registry();
+    auto position = std::lower_bound(kernels.begin(), kernels.end(), info,
+        [](const MandelbrotKernelInfo & a, const MandelbrotKernelInfo & b) {
+            return strcmp(a.name, b.name) < 0;
+        });
+    kernels.insert(position, info);
+}
+
+const std::vector<MandelbrotKernelInfo> & mandelbrotKernels() {
+    return registry();
+}
+
+const MandelbrotKernelInfo * findMandelbrotKernel(const char * name) {
+    for (const MandelbrotKernelInfo & info : registry()) {
+        if (strcmp(info.name, name) == 0) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+bool isaSupported(MandelbrotISA isa) {
+    switch (isa) {
+#if !defined(NEON) && !defined(SVE)
+        case ISA_AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case ISA_AVX512:
+            return __builtin_cpu_supports("avx512f");
+#else
+        // The ARM builds only contain kernels for the instruction set they were compiled for
+        case ISA_NEON:
+        case ISA_SVE:
+            return true;
+#endif
+        case ISA_ANY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+const char * isaName(MandelbrotISA isa) {
+    switch (isa) {
+        case ISA_AVX2:
+            return "AVX2";
+        case ISA_AVX512:
+            return "AVX512";
+        case ISA_NEON:
+            return "NEON";
+        case ISA_SVE:
+            return "SVE";
+        default:
+            return "any";
+    }
+}
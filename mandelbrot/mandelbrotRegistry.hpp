@@ -0,0 +1,89 @@
+#ifndef mandelbrotRegistry
+#define mandelbrotRegistry
+
+#include <stddef.h>
+#include <vector>
+
+#include "mandelbrotThreaded.hpp"
+
+/* Every implementation registers its kernel with REGISTER_MANDELBROT_KERNEL in its own translation
+ * unit, so a kernel is available exactly in the builds that compile it. The registry is filled 
+ * during static initialization, it must not be used before main. */
+
+/**
+ * Instruction set a kernel needs at runtime.
+*/
+enum MandelbrotISA {
+    ISA_ANY,
+    ISA_AVX2,
+    ISA_AVX512,
+    ISA_NEON,
+    ISA_SVE
+};
+
+/**
+ * Description of a registered kernel.
+*/
+struct MandelbrotKernelInfo {
+    // Name on the command line, e.g. "avx2"
+    const char * name;
+    MandelbrotISA isa;
+    MandelbrotKernel kernel;
+    // Variant skipping the main cardioid and the period-2 bulb, nullptr if there is none
+    MandelbrotKernel interiorCheckKernel;
+    // The width has to be a multiple of it
+    size_t widthMultiple;
+    // Variant rendering a tile of a larger frame, used for threaded rendering. Registrations of
+    // kernels without one leave it out, which makes it nullptr
+    MandelbrotBlockKernel blockKernel;
+};
+
+/**
+ * Adds a kernel to the registry, used through REGISTER_MANDELBROT_KERNEL.
+*/
+class MandelbrotKernelRegistrar {
+    public:
+        MandelbrotKernelRegistrar(const MandelbrotKernelInfo & info);
+};
+
+#define REGISTER_MANDELBROT_KERNEL(identifier, ...) \
+    static MandelbrotKernelRegistrar identifier##Registrar(MandelbrotKernelInfo{__VA_ARGS__})
+
+/**
+ * Returns all kernels compiled into the program, sorted by name.
+ *
+ * @return  The registered kernels
+*/
+const std::vector<MandelbrotKernelInfo> & mandelbrotKernels();
+
+/**
+ * Searches a registered kernel by its name.
+ *
+ * @param name
+ *          The name of the kernel
+ *
+ * @return  The kernel or nullptr if no kernel has this name
+*/
+const MandelbrotKernelInfo * findMandelbrotKernel(const char * name);
+
+/**
+ * Checks whether the processor supports an instruction set.
+ *
+ * @param isa
+ *          The instruction set
+ *
+ * @return  Whether kernels needing it can run
+*/
+bool isaSupported(MandelbrotISA isa);
+
+/**
+ * Returns the name of an instruction set, e.g. "AVX2".
+ *
+ * @param isa
+ *          The instruction set
+ *
+ * @return  The name
+*/
+const char * isaName(MandelbrotISA isa);
+
+#endif  // mandelbrotRegistry
@@ -0,0 +1,145 @@
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "hwy/aligned_allocator.h"
+
+#include "mandelbrotRegistry.hpp"
+#include "mandelbrotStats.hpp"
+#include "mandelbrotThreaded.hpp"
+#include "../utils/imageWriter.hpp"
+
+using std::chrono::high_resolution_clock;
+using std::chrono::duration;
+
+/* Renders one viewport with a kernel chosen on the command line, e.g.
+ *
+ *      ./mandelRender --kernel avx2 --size 4096 4096 --threads 8 --output mandelbrot.pbm
+ *
+ * Without --output only the render times are printed. */
+
+static void printUsage(const char * program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --list                         Lists the kernels of this build and exits\n"
+              << "  --kernel NAME                  The kernel to render with (default highway)\n"
+              << "  --size WIDTH HEIGHT            The size of the image in pixels (default 1024 1024)\n"
+              << "  --viewport X0 X1 Y0 Y1         The rendered part of the plane (default -1.5 0.5 -1.5 1.5)\n"
+              << "  --threads N                    The number of rendering threads, 0 for all (default 1)\n"
+              << "  --interior                     Uses the variant with the cardioid and bulb check\n"
+              << "  --repeat N                     Renders N times and prints the fastest (default 1)\n"
+              << "  --output FILE                  Writes the image as binary Bitmap (P4)\n";
+}
+
+static void printKernels() {
+    for (const MandelbrotKernelInfo & info : mandelbrotKernels()) {
+        std::cout << info.name << "\t" << isaName(info.isa)
+                  << "\twidth multiple " << info.widthMultiple
+                  << (info.interiorCheckKernel != nullptr ? "\tinterior check" : "")
+                  << (isaSupported(info.isa) ? "" : "\tunsupported by this processor") << std::endl;
+    }
+}
+
+int main(int argc, char ** argv) {
+    const char * kernelName = "highway";
+    const char * output = nullptr;
+    size_t width = 1024;
+    size_t height = 1024;
+    float xBegin = -1.5f;
+    float xEnd = 0.5f;
+    float yBegin = -1.5f;
+    float yEnd = 1.5f;
+    size_t threads = 1;
+    int repeat = 1;
+    bool interior = false;
+
+    for (int i = 1; i < argc; i++) {
+        // Number of values following the option
+        int remaining = argc - i - 1;
+
+        if (strcmp(argv[i], "--list") == 0) {
+            printKernels();
+            return 0;
+        } else if (strcmp(argv[i], "--kernel") == 0 && remaining >= 1) {
+            kernelName = argv[++i];
+        } else if (strcmp(argv[i], "--size") == 0 && remaining >= 2) {
+            width = strtoul(argv[++i], nullptr, 10);
+            height = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--viewport") == 0 && remaining >= 4) {
+            xBegin = strtof(argv[++i], nullptr);
+            xEnd = strtof(argv[++i], nullptr);
+            yBegin = strtof(argv[++i], nullptr);
+            yEnd = strtof(argv[++i], nullptr);
+        } else if (strcmp(argv[i], "--threads") == 0 && remaining >= 1) {
+            threads = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--interior") == 0) {
+            interior = true;
+        } else if (strcmp(argv[i], "--repeat") == 0 && remaining >= 1) {
+            repeat = std::max(1, atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--output") == 0 && remaining >= 1) {
+            output = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    const MandelbrotKernelInfo * info = findMandelbrotKernel(kernelName);
+    if (info == nullptr) {
+        std::cerr << "Unknown kernel " << kernelName << ", kernels of this build:" << std::endl;
+        printKernels();
+        return 1;
+    }
+    if (!isaSupported(info->isa)) {
+        std::cerr << "The processor does not support " << isaName(info->isa) << " needed by " << info->name << std::endl;
+        return 1;
+    }
+    MandelbrotKernel kernel = interior ? info->interiorCheckKernel : info->kernel;
+    if (kernel == nullptr) {
+        std::cerr << info->name << " has no interior check variant" << std::endl;
+        return 1;
+    }
+    if (width == 0 || height == 0 || width % info->widthMultiple != 0) {
+        std::cerr << "The width has to be a multiple of " << info->widthMultiple << " for " << info->name << std::endl;
+        return 1;
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+
+    duration<double, std::milli> fastest;
+    resetMandelbrotStats();
+    for (int run = 0; run < repeat; run++) {
+        auto startTime = high_resolution_clock::now();
+        if (threads == 1) {
+            kernel(xBegin, xEnd, yBegin, yEnd, width, height, &image[0]);
+        } else if (!interior && info->blockKernel != nullptr) {
+            mandelbrot_threaded(info->blockKernel, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], threads);
+        } else {
+            // The tiles compute their own bounds, which may round the columns slightly differently
+            mandelbrot_threaded(kernel, xBegin, xEnd, yBegin, yEnd, width, height, &image[0], threads);
+        }
+        duration<double, std::milli> time = high_resolution_clock::now() - startTime;
+        fastest = (run == 0) ? time : std::min(fastest, time);
+    }
+
+    std::cout << info->name << (interior ? " (interior check)" : "") << ", " << width << "x" << height
+              << ", " << threads << " thread(s): " << fastest.count() << " ms" << std::endl;
+
+    if (mandelbrotStatsEnabled()) {
+        MandelbrotStats stats = getMandelbrotStats();
+        std::cout << "per frame: " << stats.vectorIterations / repeat << " vector iterations, "
+                  << stats.usefulLaneIterations / repeat << " of " << stats.laneIterations / repeat
+                  << " lane iterations useful (" << 100 * stats.laneUtilization() << "% lane utilization)" << std::endl;
+    }
+
+    if (output != nullptr && !writeBitmapImage(output, width, height, &image[0])) {
+        std::cerr << "Could not write " << output << std::endl;
+        return 1;
+    }
+    return 0;
+}
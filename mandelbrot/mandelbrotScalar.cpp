@@ -1,5 +1,6 @@
 #include "mandelbrotSettings.hpp"
 #include "mandelbrotScalar.hpp"
+#include "mandelbrotRegistry.hpp"
 #include "../utils/vecComplex.hpp"
 
 
@@ -43,6 +44,14 @@ void mandelbrot_scalar(float xBegin, float xEnd,
     }
 }
 
+// The registry uses the shared kernel signature with size_t dimensions
+static void mandelbrot_scalar_registered(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    mandelbrot_scalar(xBegin, xEnd, yBegin, yEnd, (int) width, (int) height, image);
+}
+REGISTER_MANDELBROT_KERNEL(scalar, "scalar", ISA_ANY, mandelbrot_scalar_registered, nullptr, 1);
+
 void mandelbrot_scalar_complexClass(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
                       int width, int height, int * image) {
@@ -1,7 +1,39 @@
 #ifndef mandelbrotSettings
 #define mandelbrotSettings
 
+#include <type_traits>
+
 #define BAILOUT 4
 #define MAX_ITERATIONS 100
+#define PERIODICITY_TOLERANCE 1e-5f
+#define SMOOTH_BAILOUT 65536   // |z|^2 bound of the smooth kernels, a large radius keeps the fractional counts continuous
+
+/**
+ * Calls the kernel with the iteration cap as compile time constant if a specialization exists 
+ *  for it and with 0 otherwise, in which case the kernel has to use the runtime cap.
+ * 
+ * @param maxIterations
+ *          The iteration cap requested at runtime
+ * @param kernel
+ *          A callable taking a std::integral_constant<int, N>
+ * 
+*/
+template <class Kernel>
+inline void dispatchIterations(int maxIterations, Kernel kernel) {
+    switch (maxIterations) {
+        case 100:
+            kernel(std::integral_constant<int, 100>());
+            break;
+        case 256:
+            kernel(std::integral_constant<int, 256>());
+            break;
+        case 1000:
+            kernel(std::integral_constant<int, 1000>());
+            break;
+        default:
+            kernel(std::integral_constant<int, 0>());
+            break;
+    }
+}
 
 #endif
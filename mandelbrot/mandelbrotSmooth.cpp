@@ -0,0 +1,181 @@
+#include <assert.h>
+#include <hwy/highway.h>
+#include <hwy/contrib/math/math-inl.h>
+
+#include "mandelbrotSettings.hpp"
+#include "mandelbrotSmooth.hpp"
+
+#if !defined(NEON) && !defined(SVE)
+#include <immintrin.h>
+#endif  // NEON and SVE
+
+/* The kernels iterate like the _iterations kernels, but with the bailout SMOOTH_BAILOUT. A lane
+ * stays live until its first escaped value, which freezes its |z|^2. Both logarithms are taken
+ * once per vector after the loop, their cost is spread over all iterations of the pixels. */
+
+#ifndef NEON
+#ifndef SVE
+/* log2 for positive normal values. The exponent is taken from the bits, the mantissa m is moved
+ * into [sqrt(1/2), sqrt(2)) and log2(m) = 2 / ln(2) * atanh(t) with t = (m - 1) / (m + 1) is
+ * evaluated up to t^7, which is exact to about 1e-7 for |t| < 0.172. */
+static inline __m256 log2_avx2(__m256 x) {
+    __m256i bits = _mm256_castps_si256(x);
+    __m256i exponent = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127));
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)),
+                                                   _mm256_set1_epi32(0x3F800000)));
+
+    // The mask is all ones (-1) where the mantissa is halved and the exponent grows by one
+    __m256 large = _mm256_cmp_ps(m, _mm256_set1_ps(1.41421356f), _CMP_GT_OQ);
+    m = _mm256_blendv_ps(m, _mm256_mul_ps(m, _mm256_set1_ps(0.5f)), large);
+    exponent = _mm256_sub_epi32(exponent, _mm256_castps_si256(large));
+
+    __m256 t = _mm256_div_ps(_mm256_sub_ps(m, _mm256_set1_ps(1.0f)), _mm256_add_ps(m, _mm256_set1_ps(1.0f)));
+    __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 p = _mm256_fmadd_ps(t2, _mm256_set1_ps(0.41219858f), _mm256_set1_ps(0.57707802f));
+    p = _mm256_fmadd_ps(p, t2, _mm256_set1_ps(0.96179669f));
+    p = _mm256_fmadd_ps(p, t2, _mm256_set1_ps(2.88539008f));
+    return _mm256_fmadd_ps(p, t, _mm256_cvtepi32_ps(exponent));
+}
+
+void mandelbrot_avx2_smooth(float xBegin, float xEnd,
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, float * smooth) {
+    mandelbrot_avx2_smooth_block(xBegin, yBegin, (xEnd - xBegin) / width, (yEnd - yBegin) / height, 0, 0,
+                     width, height, smooth);
+}
+
+void mandelbrot_avx2_smooth_block(float xBegin, float yBegin,
+                     float xScale, float yScale,
+                     size_t xOffset, size_t yOffset,
+                     size_t width, size_t height, float * smooth) {
+    assert((width * height) % 8 == 0);
+
+    __m256 xScaleVec = _mm256_set1_ps(xScale);
+    __m256 xBeginVec = _mm256_set1_ps(xBegin);
+    __m256 bailoutVec = _mm256_set1_ps(SMOOTH_BAILOUT);
+    __m256 insideVec = _mm256_set1_ps(MAX_ITERATIONS + 1);
+    __m256 oneVec = _mm256_set1_ps(1.0f);
+    __m256 halfVec = _mm256_set1_ps(0.5f);
+
+    for (size_t j = 0; j < height; j++) {
+        __m256 c_imag = _mm256_set1_ps (yBegin + ((yOffset + j) * yScale));
+        for (size_t i = 0; i < width; i += 8) {
+            size_t x = xOffset + i;
+            __m256 c_real = _mm256_set_ps(8 + x, 7 + x, 6 + x, 5 + x, 4 + x, 3 + x, 2 + x, 1 + x);
+            c_real = _mm256_fmadd_ps(c_real, xScaleVec, xBeginVec);
+
+            __m256 z_real = _mm256_setzero_ps();
+            __m256 z_imag = _mm256_setzero_ps();
+            __m256 escapedNorm = _mm256_setzero_ps();
+            __m256 live = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            __m256i counter = _mm256_setzero_si256();
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                __m256 z_real_squared = _mm256_mul_ps(z_real, z_real);
+                __m256 z_imag_squared = _mm256_mul_ps(z_imag, z_imag);
+                __m256 temp = _mm256_mul_ps(z_real, z_imag);
+
+                z_real = _mm256_add_ps(_mm256_sub_ps(z_real_squared, z_imag_squared), c_real);
+                z_imag = _mm256_add_ps(_mm256_add_ps(temp, temp), c_imag);
+
+                __m256 norm = _mm256_add_ps(z_real_squared, z_imag_squared);
+
+                __m256 mask = _mm256_cmp_ps(norm, bailoutVec, _CMP_LT_OQ);
+
+                /* live lanes take the norm, so it freezes at the first escaped value */
+                escapedNorm = _mm256_blendv_ps(escapedNorm, norm, live);
+                live = _mm256_and_ps(live, mask);
+                counter = _mm256_sub_epi32(counter, _mm256_castps_si256(mask));
+
+                if (_mm256_movemask_ps(mask) == 0 || iteration > MAX_ITERATIONS) {
+                    __m256 n = _mm256_cvtepi32_ps(counter);
+                    __m256 nu = _mm256_sub_ps(_mm256_add_ps(n, oneVec),
+                                              log2_avx2(_mm256_mul_ps(halfVec, log2_avx2(escapedNorm))));
+                    _mm256_storeu_ps(&smooth[(j * width) + i], _mm256_blendv_ps(nu, insideVec, mask));
+                    break;
+                }
+            }
+        }
+    }
+}
+#endif
+#endif
+
+
+HWY_BEFORE_NAMESPACE();
+HWY_ATTR void mandelbrot_highway_smooth(float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT smooth) {
+    mandelbrot_highway_smooth_block(xBegin, yBegin, (xEnd - xBegin) / width, (yEnd - yBegin) / height, 0, 0,
+                      width, height, smooth);
+}
+
+HWY_ATTR void mandelbrot_highway_smooth_block(float xBegin, float yBegin,
+                      float xScale, float yScale,
+                      size_t xOffset, size_t yOffset,
+                      size_t width, size_t height,
+                      float* const HWY_RESTRICT smooth) {
+    using namespace hwy;
+    using namespace HWY_NAMESPACE;
+
+    const ScalableTag<float> d;
+    const RebindToSigned<decltype(d)> di;
+    const size_t N = Lanes(d);
+    using V = decltype(Zero(d));
+
+    assert((width * height) % N == 0); // Ensure that vector lanes fit
+
+    auto xScaleVec = Set(d, xScale);
+    auto xBeginVec = Set(d, xBegin);
+    auto bailoutVec = Set(d, SMOOTH_BAILOUT);
+    auto insideVec = Set(d, MAX_ITERATIONS + 1);
+    auto oneVec = Set(d, 1.0f);
+    auto halfVec = Set(d, 0.5f);
+
+    for (size_t j = 0; j < height; j++) {
+            auto c_imag = Set(d, yBegin + ((yOffset + j) * yScale));
+        for (size_t i = 0; i < width; i += N) {
+            auto c_real = Iota(d, xOffset + i);
+            c_real = MulAdd(c_real, xScaleVec, xBeginVec);
+
+            V z_real = Zero(d);
+            V z_imag = Zero(d);
+            V escapedNorm = Zero(d);
+            auto live = FirstN(d, N);
+            auto counter = Zero(di);
+
+            int iteration = 0;
+            while(1) {
+                iteration++;
+
+                auto z_real_squared = Mul(z_real, z_real);
+                auto z_imag_squared = Mul(z_imag, z_imag);
+                auto temp = Mul(z_real, z_imag);
+
+                z_real = Add(Sub(z_real_squared, z_imag_squared), c_real);
+                z_imag = Add(Add(temp, temp), c_imag);
+
+                /* masking of bailout values */
+                auto norm = Add(z_real_squared, z_imag_squared);
+                auto mask = Lt(norm, bailoutVec);
+
+                /* live lanes take the norm, so it freezes at the first escaped value */
+                escapedNorm = IfThenElse(live, norm, escapedNorm);
+                live = And(live, mask);
+                counter = Sub(counter, VecFromMask(di, RebindMask(di, mask)));
+
+                if (iteration > MAX_ITERATIONS || AllFalse(d, mask)) {
+                    auto n = ConvertTo(d, counter);
+                    auto nu = Sub(Add(n, oneVec), Log2(d, Mul(halfVec, Log2(d, escapedNorm))));
+                    StoreU(IfThenElse(mask, insideVec, nu), d, &smooth[(j * width) + i]);
+                    break;
+                }
+            }
+        }
+    }
+}
+HWY_AFTER_NAMESPACE();
@@ -0,0 +1,125 @@
+#ifndef mandelbrotSmooth
+#define mandelbrotSmooth
+
+#include <stddef.h>
+#include <hwy/highway.h>
+
+/* Kernels with continuous escape counts for smooth coloring. Every lane keeps |z|^2 of the first
+ * value beyond SMOOTH_BAILOUT and after the loop the whole vector computes
+ *      nu = n + 1 - log2(log2(|z|)) = n + 1 - log2(0.5 * log2(|z|^2))
+ * with a vectorized logarithm. Points inside the set get MAX_ITERATIONS + 1. */
+
+#ifndef NEON
+#ifndef SVE
+/**
+ * Calculates the continuous escape count of each point of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using intrinsics and a polynomial log2.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param smooth
+ *          The array receiving the continuous escape count of each pixel
+ * 
+*/
+void mandelbrot_avx2_smooth(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height, float * smooth);
+
+/**
+ * Calculates the continuous escape counts of a block of a larger image like mandelbrot_avx2_smooth,
+ *  with the signature of a MandelbrotBlockKernel.
+ * 
+ * @param xBegin
+ *          The x value of the left boarder of the larger image
+ * @param yBegin
+ *          The y value of the top boarder of the larger image
+ * @param xScale
+ *          The width of a pixel
+ * @param yScale
+ *          The height of a pixel
+ * @param xOffset
+ *          The first column of the block in the larger image
+ * @param yOffset
+ *          The first row of the block in the larger image
+ * @param width 
+ *          The width of the block
+ * @param heigth
+ *          The height of the block 
+ * @param smooth
+ *          The array receiving the continuous escape count of each pixel of the block
+ * 
+*/
+void mandelbrot_avx2_smooth_block(float xBegin, float yBegin,
+                     float xScale, float yScale,
+                     size_t xOffset, size_t yOffset,
+                     size_t width, size_t height, float * smooth);
+#endif	// SVE
+#endif	// NEON
+
+
+/**
+ * Calculates the continuous escape count of each point of the mandelbrot set with the given dimensions, 
+ *  employing vectorization by using the Highway library and its vectorized log2.
+ * 
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image  
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width 
+ *          The width of the image
+ * @param heigth
+ *          The height of the image 
+ * @param smooth
+ *          The array receiving the continuous escape count of each pixel
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_smooth(float realBeginning, float realEnd, 
+                     float imagBeginning, float imagEnd,
+                     size_t width, size_t height,
+                     float* const HWY_RESTRICT smooth);
+
+/**
+ * Calculates the continuous escape counts of a block of a larger image like mandelbrot_highway_smooth,
+ *  with the signature of a MandelbrotBlockKernel.
+ * 
+ * @param xBegin
+ *          The x value of the left boarder of the larger image
+ * @param yBegin
+ *          The y value of the top boarder of the larger image
+ * @param xScale
+ *          The width of a pixel
+ * @param yScale
+ *          The height of a pixel
+ * @param xOffset
+ *          The first column of the block in the larger image
+ * @param yOffset
+ *          The first row of the block in the larger image
+ * @param width 
+ *          The width of the block
+ * @param heigth
+ *          The height of the block 
+ * @param smooth
+ *          The array receiving the continuous escape count of each pixel of the block
+ * 
+*/
+HWY_ATTR void mandelbrot_highway_smooth_block(float xBegin, float yBegin,
+                     float xScale, float yScale,
+                     size_t xOffset, size_t yOffset,
+                     size_t width, size_t height,
+                     float* const HWY_RESTRICT smooth);
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef mandelbrotStats
+#define mandelbrotStats
+
+#include <stdint.h>
+#include <atomic>
+
+/* Optional instrumentation of the vectorized kernels, compiled in with -DMANDELBROT_STATS (make STATS=1).
+ * Without the define the macros expand to nothing and the kernels are unchanged. */
+
+/**
+ * Counters of the z-iterations executed by the instrumented kernels since the last reset.
+ *  A lane iteration is useful while the point of the lane is still below the bailout value, so
+ *  usefulLaneIterations equals the summed iteration counts of the mandelbrot_*_iterations kernels.
+ *
+*/
+struct MandelbrotStats {
+    uint64_t vectorIterations;
+    uint64_t laneIterations;
+    uint64_t usefulLaneIterations;
+
+    /**
+     * Returns the share of the executed lane iterations that were useful, 1 if no lane was wasted
+    */
+    double laneUtilization() const {
+        return laneIterations == 0 ? 0.0 : (double) usefulLaneIterations / laneIterations;
+    }
+};
+
+namespace mandelbrot_stats_detail {
+    inline std::atomic<uint64_t> vectorIterations(0);
+    inline std::atomic<uint64_t> laneIterations(0);
+    inline std::atomic<uint64_t> usefulLaneIterations(0);
+}
+
+/**
+ * Returns whether the kernels were compiled with the instrumentation
+*/
+inline constexpr bool mandelbrotStatsEnabled() {
+#ifdef MANDELBROT_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Sets all counters to zero, has to be called while no kernel runs
+*/
+inline void resetMandelbrotStats() {
+    mandelbrot_stats_detail::vectorIterations = 0;
+    mandelbrot_stats_detail::laneIterations = 0;
+    mandelbrot_stats_detail::usefulLaneIterations = 0;
+}
+
+/**
+ * Returns the counters summed over all threads since the last reset
+*/
+inline MandelbrotStats getMandelbrotStats() {
+    return MandelbrotStats{mandelbrot_stats_detail::vectorIterations.load(),
+                           mandelbrot_stats_detail::laneIterations.load(),
+                           mandelbrot_stats_detail::usefulLaneIterations.load()};
+}
+
+#ifdef MANDELBROT_STATS
+/* Counts in locals for one kernel call and adds them to the shared counters once on return,
+ * so the threads of a frame don't contend on the atomics inside the iteration loop. */
+class MandelbrotStatsScope {
+    public:
+        explicit MandelbrotStatsScope(uint64_t lanes) : lanes(lanes), vectorIterations(0), usefulLaneIterations(0) {}
+
+        ~MandelbrotStatsScope() {
+            mandelbrot_stats_detail::vectorIterations += vectorIterations;
+            mandelbrot_stats_detail::laneIterations += vectorIterations * lanes;
+            mandelbrot_stats_detail::usefulLaneIterations += usefulLaneIterations;
+        }
+
+        void iteration(uint64_t usefulLanes) {
+            vectorIterations++;
+            usefulLaneIterations += usefulLanes;
+        }
+
+    private:
+        uint64_t lanes;
+        uint64_t vectorIterations;
+        uint64_t usefulLaneIterations;
+};
+
+#define MANDELBROT_STATS_BEGIN(lanes) MandelbrotStatsScope mandelbrotStatsScope(lanes)
+#define MANDELBROT_STATS_ITERATION(usefulLanes) mandelbrotStatsScope.iteration(usefulLanes)
+#else
+#define MANDELBROT_STATS_BEGIN(lanes)
+#define MANDELBROT_STATS_ITERATION(usefulLanes)
+#endif
+
+#endif
@@ -0,0 +1,151 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#include "mandelbrotSubdivision.hpp"
+
+const static size_t strip = SUBDIVISION_STRIP;
+
+struct SubdivisionJob {
+    MandelbrotBlockKernel kernel;
+    float xBegin;
+    float yBegin;
+    float xScale;
+    float yScale;
+    size_t width;
+    float * image;
+    float * buffer;
+    size_t bufferSize;
+    size_t iterated;
+};
+
+// Renders the block with the kernel, as many rows at a time as fit into the aligned buffer
+static void renderBlock(SubdivisionJob & job, size_t x, size_t y, size_t w, size_t h) {
+    size_t rowsPerCall = job.bufferSize / w;
+
+    for (size_t row = 0; row < h; row += rowsPerCall) {
+        size_t rows = std::min(rowsPerCall, h - row);
+        job.kernel(job.xBegin, job.yBegin, job.xScale, job.yScale, x, y + row, w, rows, job.buffer);
+
+        for (size_t j = 0; j < rows; j++) {
+            memcpy(&job.image[(y + row + j) * job.width + x], &job.buffer[j * w], w * sizeof(float));
+        }
+    }
+    job.iterated += w * h;
+}
+
+static void fillBlock(SubdivisionJob & job, size_t x, size_t y, size_t w, size_t h, float value) {
+    for (size_t j = y; j < y + h; j++) {
+        std::fill_n(&job.image[j * job.width + x], w, value);
+    }
+}
+
+static bool uniformBlock(const SubdivisionJob & job, size_t x, size_t y, size_t w, size_t h, float value) {
+    for (size_t j = y; j < y + h; j++) {
+        const float * row = &job.image[j * job.width + x];
+        for (size_t i = 0; i < w; i++) {
+            if (row[i] != value) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool uniformBorder(const SubdivisionJob & job, size_t x, size_t y, size_t w, size_t h) {
+    float value = job.image[y * job.width + x];
+    return uniformBlock(job, x, y, w, 1, value)
+        && uniformBlock(job, x, y + h - 1, w, 1, value)
+        && uniformBlock(job, x, y + 1, strip, h - 2, value)
+        && uniformBlock(job, x + w - strip, y + 1, strip, h - 2, value);
+}
+
+static bool containsOrigin(const SubdivisionJob & job, size_t x, size_t y, size_t w, size_t h) {
+    float xFirst = job.xBegin + x * job.xScale;
+    float xLast = job.xBegin + (x + w) * job.xScale;
+    float yFirst = job.yBegin + y * job.yScale;
+    float yLast = job.yBegin + (y + h) * job.yScale;
+    return std::min(xFirst, xLast) <= 0.0f && std::max(xFirst, xLast) >= 0.0f
+        && std::min(yFirst, yLast) <= 0.0f && std::max(yFirst, yLast) >= 0.0f;
+}
+
+/* The boarder of the rectangle, its top and bottom row and the strips on the left and
+ * right, is already rendered. The children share the middle strip and row with their neighbours. */
+static void subdivide(SubdivisionJob & job, size_t x, size_t y, size_t w, size_t h) {
+    if (uniformBorder(job, x, y, w, h) && !containsOrigin(job, x, y, w, h)) {
+        fillBlock(job, x + strip, y + 1, w - 2 * strip, h - 2, job.image[y * job.width + x]);
+        return;
+    }
+
+    // Every child needs at least one strip and one row between its boarders
+    bool splitX = w >= 5 * strip;
+    bool splitY = h >= 6;
+    if (!splitX && !splitY) {
+        renderBlock(job, x + strip, y + 1, w - 2 * strip, h - 2);
+        return;
+    }
+
+    size_t xMiddle = splitX ? x + strip * (w / (2 * strip)) : x;
+    size_t yMiddle = splitY ? y + h / 2 : y;
+
+    if (splitX) {
+        renderBlock(job, xMiddle, y + 1, strip, h - 2);
+    }
+    if (splitY && splitX) {
+        renderBlock(job, x + strip, yMiddle, xMiddle - x - strip, 1);
+        renderBlock(job, xMiddle + strip, yMiddle, x + w - strip - (xMiddle + strip), 1);
+    } else if (splitY) {
+        renderBlock(job, x + strip, yMiddle, w - 2 * strip, 1);
+    }
+
+    // Left and right, top and bottom child as pairs of position and size
+    size_t columns[2][2] = {{x, xMiddle + strip - x}, {xMiddle, x + w - xMiddle}};
+    size_t rows[2][2] = {{y, yMiddle + 1 - y}, {yMiddle, y + h - yMiddle}};
+    if (!splitX) {
+        columns[0][1] = w;
+    }
+    if (!splitY) {
+        rows[0][1] = h;
+    }
+
+    for (size_t b = 0; b < (splitY ? 2 : 1); b++) {
+        for (size_t a = 0; a < (splitX ? 2 : 1); a++) {
+            subdivide(job, columns[a][0], rows[b][0], columns[a][1], rows[b][1]);
+        }
+    }
+}
+
+size_t mandelbrot_subdivision(MandelbrotBlockKernel kernel,
+                      float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image) {
+    assert(width % strip == 0);
+
+    SubdivisionJob job;
+    job.kernel = kernel;
+    job.xBegin = xBegin;
+    job.yBegin = yBegin;
+    job.xScale = (xEnd - xBegin) / width;
+    job.yScale = (yEnd - yBegin) / height;
+    job.width = width;
+    job.image = image;
+    job.iterated = 0;
+
+    // The kernels use aligned stores, every block is rendered into an aligned buffer first
+    job.bufferSize = std::max(width, strip * height);
+    job.buffer = static_cast<float *>(aligned_alloc(64, ((job.bufferSize * sizeof(float) + 63) / 64) * 64));
+
+    if (width < 3 * strip || height < 3) {
+        renderBlock(job, 0, 0, width, height);
+    } else {
+        renderBlock(job, 0, 0, width, 1);
+        renderBlock(job, 0, height - 1, width, 1);
+        renderBlock(job, 0, 1, strip, height - 2);
+        renderBlock(job, width - strip, 1, strip, height - 2);
+        subdivide(job, 0, 0, width, height);
+    }
+
+    free(job.buffer);
+    return job.iterated;
+}
@@ -0,0 +1,46 @@
+#ifndef mandelbrotSubdivision
+#define mandelbrotSubdivision
+
+#include <stddef.h>
+
+#include "mandelbrotThreaded.hpp"
+
+// Width of the vertical boarder strips in pixels, a multiple of the widest vector of any kernel
+#define SUBDIVISION_STRIP 16
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions after Mariani and Silver.
+ *  Only the boarder of a rectangle is rendered with the kernel, if all of it has the same value
+ *  the inside is filled with it. Otherwise the rectangle is split and its parts are processed
+ *  the same way. As the set is connected, a uniform boarder can only enclose other values if the 
+ *  whole set lies inside, so rectangles containing the origin are always split.
+ *  Vertical boarders are strips of SUBDIVISION_STRIP pixels, so that all kernel calls cover 
+ *  whole vectors. The width has to be a multiple of SUBDIVISION_STRIP.
+ *  The boarders are rendered with the pixel scale of the whole image, so every rendered pixel
+ *  is identical to the one of the block kernel for the whole image.
+ *
+ * @param kernel
+ *          The single threaded block kernel used to render the boarders
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ *
+ * @return  The number of pixels rendered by the kernel
+*/
+size_t mandelbrot_subdivision(MandelbrotBlockKernel kernel,
+                      float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image);
+
+#endif  // mandelbrotSubdivision
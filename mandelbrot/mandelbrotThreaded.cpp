@@ -0,0 +1,226 @@
+#include <assert.h>
+#include <string.h>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "mandelbrotThreaded.hpp"
+
+/* Double ended queue of tile indices owned by one worker. The owner pops from
+ * the back, idle workers steal from the front. */
+class TileQueue {
+    public:
+        void push(size_t tile) {
+            std::lock_guard<std::mutex> guard(lock);
+            tiles.push_back(tile);
+        }
+
+        bool pop(size_t & tile) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (tiles.empty()) {
+                return false;
+            }
+            tile = tiles.back();
+            tiles.pop_back();
+            return true;
+        }
+
+        bool steal(size_t & tile) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (tiles.empty()) {
+                return false;
+            }
+            tile = tiles.front();
+            tiles.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex lock;
+        std::deque<size_t> tiles;
+};
+
+class BandTracker;
+
+struct TileJob {
+    MandelbrotKernel kernel;
+    MandelbrotBlockKernel blockKernel;
+    float xBegin;
+    float yBegin;
+    float xScale;
+    float yScale;
+    size_t width;
+    size_t height;
+    size_t tilesPerRow;
+    float * image;
+    BandTracker * bands;
+};
+
+/* Counts the unfinished tiles of every band of tile rows. The thread finishing a band hands all
+ * consecutive finished bands to the callback, outside of the lock so the other threads keep going. */
+class BandTracker {
+    public:
+        BandTracker(size_t bands, size_t tilesPerBand, RowsCallback callback, void * userData)
+            : remaining(bands, tilesPerBand), nextBand(0), emitting(false),
+              callback(callback), userData(userData) {}
+
+        void tileDone(const TileJob & job, size_t band) {
+            std::unique_lock<std::mutex> guard(lock);
+            remaining[band]--;
+
+            // The thread already emitting picks up this band once it is next
+            if (emitting) {
+                return;
+            }
+            emitting = true;
+
+            while (nextBand < remaining.size() && remaining[nextBand] == 0) {
+                size_t first = nextBand;
+                while (nextBand < remaining.size() && remaining[nextBand] == 0) {
+                    nextBand++;
+                }
+                guard.unlock();
+
+                size_t firstRow = first * TILE_HEIGHT;
+                size_t endRow = (nextBand * TILE_HEIGHT < job.height) ? nextBand * TILE_HEIGHT : job.height;
+                callback(&job.image[firstRow * job.width], firstRow, endRow - firstRow, userData);
+
+                guard.lock();
+            }
+            emitting = false;
+        }
+
+    private:
+        std::mutex lock;
+        std::vector<size_t> remaining;
+        size_t nextBand;
+        bool emitting;
+        RowsCallback callback;
+        void * userData;
+};
+
+static void renderTile(const TileJob & job, size_t tile, float * buffer) {
+    size_t x = (tile % job.tilesPerRow) * TILE_WIDTH;
+    size_t y = (tile / job.tilesPerRow) * TILE_HEIGHT;
+    size_t tileWidth = (job.width - x < TILE_WIDTH) ? job.width - x : TILE_WIDTH;
+    size_t tileHeight = (job.height - y < TILE_HEIGHT) ? job.height - y : TILE_HEIGHT;
+
+    if (job.blockKernel) {
+        job.blockKernel(job.xBegin, job.yBegin, job.xScale, job.yScale, x, y, tileWidth, tileHeight, buffer);
+    } else {
+        float tileXBegin = job.xBegin + x * job.xScale;
+        float tileYBegin = job.yBegin + y * job.yScale;
+
+        job.kernel(tileXBegin, tileXBegin + tileWidth * job.xScale,
+                   tileYBegin, tileYBegin + tileHeight * job.yScale,
+                   tileWidth, tileHeight, buffer);
+    }
+
+    for (size_t j = 0; j < tileHeight; j++) {
+        memcpy(&job.image[(y + j) * job.width + x], &buffer[j * tileWidth], tileWidth * sizeof(float));
+    }
+
+    if (job.bands) {
+        job.bands->tileDone(job, tile / job.tilesPerRow);
+    }
+}
+
+static void worker(const TileJob & job, std::vector<TileQueue> & queues, size_t id) {
+    // The kernels use aligned stores, so every tile is rendered into an aligned buffer first
+    alignas(64) float buffer[TILE_WIDTH * TILE_HEIGHT];
+    size_t tile;
+
+    while (1) {
+        if (queues[id].pop(tile)) {
+            renderTile(job, tile, buffer);
+            continue;
+        }
+
+        bool stolen = false;
+        for (size_t k = 1; k < queues.size() && !stolen; k++) {
+            stolen = queues[(id + k) % queues.size()].steal(tile);
+        }
+
+        // No tiles are created while rendering, so all queues being empty means we are done
+        if (!stolen) {
+            break;
+        }
+        renderTile(job, tile, buffer);
+    }
+}
+
+static void renderThreaded(MandelbrotKernel kernel, MandelbrotBlockKernel blockKernel,
+                      float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads, RowsCallback callback, void * userData) {
+    assert(threads > 0);
+
+    TileJob job;
+    job.kernel = kernel;
+    job.blockKernel = blockKernel;
+    job.xBegin = xBegin;
+    job.yBegin = yBegin;
+    job.xScale = (xEnd - xBegin) / width;
+    job.yScale = (yEnd - yBegin) / height;
+    job.width = width;
+    job.height = height;
+    job.tilesPerRow = (width + TILE_WIDTH - 1) / TILE_WIDTH;
+    job.image = image;
+
+    size_t tileRows = (height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+    size_t tiles = job.tilesPerRow * tileRows;
+
+    BandTracker bands(tileRows, job.tilesPerRow, callback, userData);
+    job.bands = callback ? &bands : NULL;
+
+    // Every thread starts with a contiguous block of tiles. Neighbouring tiles have a similar
+    // cost, so the blocks are unbalanced and the threads finishing early steal the remainder.
+    std::vector<TileQueue> queues(threads);
+    for (size_t t = 0; t < tiles; t++) {
+        queues[(t * threads) / tiles].push(t);
+    }
+
+    std::vector<std::thread> pool;
+    for (size_t id = 1; id < threads; id++) {
+        pool.emplace_back(worker, std::cref(job), std::ref(queues), id);
+    }
+    worker(job, queues, 0);
+
+    for (std::thread & t : pool) {
+        t.join();
+    }
+}
+
+void mandelbrot_threaded(MandelbrotKernel kernel,
+                      float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads) {
+    renderThreaded(kernel, NULL, xBegin, xEnd, yBegin, yEnd, width, height, image, threads, NULL, NULL);
+}
+
+void mandelbrot_threaded(MandelbrotBlockKernel kernel,
+                      float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads) {
+    renderThreaded(NULL, kernel, xBegin, xEnd, yBegin, yEnd, width, height, image, threads, NULL, NULL);
+}
+
+void mandelbrot_threaded_streamed(MandelbrotKernel kernel,
+                      float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads, RowsCallback callback, void * userData) {
+    renderThreaded(kernel, NULL, xBegin, xEnd, yBegin, yEnd, width, height, image, threads, callback, userData);
+}
+
+void mandelbrot_threaded_streamed(MandelbrotBlockKernel kernel,
+                      float xBegin, float xEnd,
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads, RowsCallback callback, void * userData) {
+    renderThreaded(NULL, kernel, xBegin, xEnd, yBegin, yEnd, width, height, image, threads, callback, userData);
+}
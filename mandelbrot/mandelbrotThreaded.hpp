@@ -0,0 +1,162 @@
+#ifndef mandelbrotThreaded
+#define mandelbrotThreaded
+
+#include <stddef.h>
+
+// Tile dimensions in pixels. A 64x64 float tile (16 KiB) stays resident in L1.
+#define TILE_WIDTH 64
+#define TILE_HEIGHT 64
+
+/**
+ * Signature shared by the single threaded mandelbrot kernels, which are used to render single tiles.
+*/
+typedef void (*MandelbrotKernel)(float xBegin, float xEnd,
+                                 float yBegin, float yEnd,
+                                 size_t width, size_t height, float * image);
+
+/**
+ * Signature of the kernels rendering a block of a larger image. The pixel (x, y) of the larger image
+ *  lies at xBegin + x * xScale, yBegin + y * yScale, the block starts at column xOffset and row yOffset.
+ *  Unlike a MandelbrotKernel called with the bounds of the block, the pixels are exactly those of 
+ *  the whole image.
+*/
+typedef void (*MandelbrotBlockKernel)(float xBegin, float yBegin,
+                                      float xScale, float yScale,
+                                      size_t xOffset, size_t yOffset,
+                                      size_t width, size_t height, float * image);
+
+/**
+ * Called by mandelbrot_threaded_streamed with finished rows, in order from top to bottom.
+*/
+typedef void (*RowsCallback)(const float * rows, size_t firstRow, size_t rowCount, void * userData);
+
+/**
+ * Calculates the image of the mandelbrot set with the given dimensions,
+ *  splitting it into tiles which are distributed across threads using work stealing.
+ *
+ * @param kernel
+ *          The single threaded kernel used to render a tile
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param threads
+ *          The number of threads rendering tiles
+ *
+*/
+void mandelbrot_threaded(MandelbrotKernel kernel,
+                      float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads);
+
+/**
+ * Calculates the image of the mandelbrot set like mandelbrot_threaded, rendering the tiles
+ *  with a block kernel. The image is identical to the one of the block kernel for the whole frame.
+ *
+ * @param kernel
+ *          The single threaded block kernel used to render a tile
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param threads
+ *          The number of threads rendering tiles
+ *
+*/
+void mandelbrot_threaded(MandelbrotBlockKernel kernel,
+                      float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads);
+
+/**
+ * Calculates the image of the mandelbrot set like mandelbrot_threaded, handing every band of
+ *  tile rows to the callback as soon as it and all bands above it are finished. The callback
+ *  runs on a rendering thread while the other threads continue with the remaining tiles.
+ *
+ * @param kernel
+ *          The single threaded kernel used to render a tile
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param threads
+ *          The number of threads rendering tiles
+ * @param callback
+ *          Receives the finished rows, never called concurrently
+ * @param userData
+ *          Passed on to the callback
+ *
+*/
+void mandelbrot_threaded_streamed(MandelbrotKernel kernel,
+                      float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads, RowsCallback callback, void * userData);
+
+/**
+ * Calculates the image of the mandelbrot set like mandelbrot_threaded_streamed, rendering the tiles
+ *  with a block kernel. The image is identical to the one of the block kernel for the whole frame.
+ *
+ * @param kernel
+ *          The single threaded block kernel used to render a tile
+ * @param realBeginning
+ *          The x value which sets the left boarder of the image
+ * @param realEnd
+ *          The x value which sets the right boarder of the image
+ * @param imagBeginning
+ *          The y value which sets the top boarder of the image
+ * @param imagEnd
+ *          The y value which sets the lower boarder of the image
+ * @param width
+ *          The width of the image
+ * @param heigth
+ *          The height of the image
+ * @param image
+ *          The immage array
+ * @param threads
+ *          The number of threads rendering tiles
+ * @param callback
+ *          Receives the finished rows, never called concurrently
+ * @param userData
+ *          Passed on to the callback
+ *
+*/
+void mandelbrot_threaded_streamed(MandelbrotBlockKernel kernel,
+                      float realBeginning, float realEnd,
+                      float imagBeginning, float imagEnd,
+                      size_t width, size_t height, float * image,
+                      size_t threads, RowsCallback callback, void * userData);
+
+#endif  // mandelbrotThreaded
@@ -3,8 +3,14 @@
 #ifndef nsimdBaseMandelbrot
 #define nsimdBaseMandelbrot
 
+#include <stdint.h>
+
 void mandelbrot_nsimdBase(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
                       size_t width, size_t height, float * image);
+
+void mandelbrot_nsimdBase_iterations(float xBegin, float xEnd, 
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, uint32_t * iterations);
 #endif	// nsimdBaseMandelbrot
 #endif 	// SVE
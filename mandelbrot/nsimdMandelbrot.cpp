@@ -1,8 +1,11 @@
 #ifndef SVE
 #include <nsimd/nsimd-all.hpp>
+#include <stdint.h>
+#include <assert.h>
 
 #include "mandelbrotSettings.hpp"
 #include "nsimdMandelbrot.hpp"
+#include "mandelbrotRegistry.hpp"
 
 void mandelbrot_nsimd(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
@@ -18,14 +21,10 @@ void mandelbrot_nsimd(float xBegin, float xEnd,
     floatv_t xBeginVec = set1<floatv_t>(xBegin);
     floatv_t bailoutVec = set1<floatv_t>((float) BAILOUT);
 
-    floatv_t c_real_increment = set1<floatv_t>(1.0f);
-
     for (size_t j = 0; j < height; j++) {
             floatv_t c_imag = set1<floatv_t>(yBegin + (j * yScale));
         for (size_t i = 0; i < width; i += len<floatv_t>()) {
-            floatv_t c_real = iota<floatv_t>();
-            c_real = add(c_real, c_real_increment);
-            c_real_increment = set1<floatv_t>((float) i);
+            floatv_t c_real = add(iota<floatv_t>(), set1<floatv_t>((float) (i + 1)));
 
             c_real = fma(c_real, xScaleVec, xBeginVec);
 
@@ -59,5 +58,66 @@ void mandelbrot_nsimd(float xBegin, float xEnd,
         }
     }
 }
+REGISTER_MANDELBROT_KERNEL(nsimd, "nsimd", ISA_ANY, mandelbrot_nsimd, nullptr, nsimd::len<nsimd::pack<float> >());
+
+
+void mandelbrot_nsimd_iterations(float xBegin, float xEnd, 
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, uint32_t * iterations) {
+    using namespace nsimd;
+    typedef pack<float> floatv_t;
+    typedef packl<float> maskv_t;
+
+    float xScale = (xEnd - xBegin) / width;
+    float yScale = (yEnd - yBegin) / height;
+
+    floatv_t xScaleVec = set1<floatv_t>(xScale);
+    floatv_t xBeginVec = set1<floatv_t>(xBegin);
+    floatv_t bailoutVec = set1<floatv_t>((float) BAILOUT);
+    floatv_t oneVec = set1<floatv_t>(1.0f);
+    floatv_t zeroVec = set1<floatv_t>(0.0f);
+    __attribute__((aligned(64))) float counts[NSIMD_MAX_LEN(f32)];
+
+    // the counts are stored a whole vector at a time
+    assert(width % len<floatv_t>() == 0);
+
+    for (size_t j = 0; j < height; j++) {
+            floatv_t c_imag = set1<floatv_t>(yBegin + (j * yScale));
+        for (size_t i = 0; i < width; i += len<floatv_t>()) {
+            floatv_t c_real = add(iota<floatv_t>(), set1<floatv_t>((float) (i + 1)));
+
+            c_real = fma(c_real, xScaleVec, xBeginVec);
+
+            floatv_t z_real = set1<floatv_t>(0.0f);
+            floatv_t z_imag = set1<floatv_t>(0.0f);
+            floatv_t counter = set1<floatv_t>(0.0f);
+
+            int iteration = 0; 
+            while(1) {
+                iteration++;
+
+                floatv_t z_real_squared = mul(z_real, z_real); 
+                floatv_t z_imag_squared = mul(z_imag, z_imag);
+                floatv_t temp = mul(z_real, z_imag);
+
+                z_real = add(sub(z_real_squared, z_imag_squared), c_real);
+                z_imag = add(add(temp, temp), c_imag);
+
+                /* masking of bailout values */
+                floatv_t norm = add(z_real_squared, z_imag_squared);
+                maskv_t mask = lt(norm, bailoutVec); 
+                counter = add(counter, if_else1(mask, oneVec, zeroVec));
+
+                if (iteration > MAX_ITERATIONS || !any(mask)) {
+                    storea(counts, counter);
+                    for (int x = 0; x < len<floatv_t>(); x++) {
+                        iterations[(j * width) + i + x] = (uint32_t) counts[x];
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
 
 #endif
@@ -3,10 +3,16 @@
 #ifndef nsimdMandelbrot
 #define nsimdMandelbrot
 
+#include <stdint.h>
+
 void mandelbrot_nsimd(float xBegin, float xEnd, 
                       float yBegin, float yEnd,
                       size_t width, size_t height, float * image);
 
+void mandelbrot_nsimd_iterations(float xBegin, float xEnd, 
+                      float yBegin, float yEnd,
+                      size_t width, size_t height, uint32_t * iterations);
+
 
 
 
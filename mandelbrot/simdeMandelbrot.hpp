@@ -1,7 +1,13 @@
 #ifndef simdeMandelbrot
 #define simdeMandelbrot
 
+#include <stdint.h>
+
 void mandelbrot_simde_avx2(float xBegin, float xEnd, 
                      float yBegin, float yEnd,
                      size_t width, size_t height, float * image); 
+
+void mandelbrot_simde_avx2_iterations(float xBegin, float xEnd, 
+                     float yBegin, float yEnd,
+                     size_t width, size_t height, uint32_t * iterations); 
 #endif
\ No newline at end of file
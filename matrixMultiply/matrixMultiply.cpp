@@ -0,0 +1,485 @@
+#include <assert.h>
+#include <immintrin.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hwy/highway.h>
+#include <Vc/Vc>
+#include <simdpp/simd.h>
+#include <pure_simd.hpp>
+
+#include "matrixMultiply.hpp"
+
+void sgemm_naive(float * a, float * b, float * c, size_t m, size_t n, size_t k) {
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            float sum = 0;
+            for (size_t p = 0; p < k; p++) {
+                sum += a[i * k + p] * b[p * n + j];
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
+
+/* Rows of an MR row panel of A, column after column, rows past the matrix are zero */
+static void packPanelA(const float * a, size_t lda, size_t kc, size_t rows, size_t MR, float * packed) {
+    for (size_t p = 0; p < kc; p++) {
+        for (size_t r = 0; r < MR; r++) {
+            packed[p * MR + r] = (r < rows) ? a[r * lda + p] : 0.0f;
+        }
+    }
+}
+
+/* Columns of an NR column panel of B, row after row, columns past the matrix are zero */
+static void packPanelB(const float * b, size_t ldb, size_t kc, size_t cols, size_t NR, float * packed) {
+    for (size_t p = 0; p < kc; p++) {
+        memcpy(packed + p * NR, b + p * ldb, cols * sizeof(float));
+        memset(packed + p * NR + cols, 0, (NR - cols) * sizeof(float));
+    }
+}
+
+static size_t roundUp(size_t x, size_t multiple) {
+    return (x + multiple - 1) / multiple * multiple;
+}
+
+/* The loops around the micro-kernel. Micro::kernel adds the product of an MR x kc panel of A and a
+ * kc x NR panel of B, both packed, to an MR x NR tile of C with row stride ldc. Tiles at the right
+ * and bottom border are computed into a zeroed buffer and only their valid part is added to C. */
+template <typename Micro>
+static void sgemm_blocked(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads) {
+    assert(threads > 0);
+    const size_t MR = Micro::MR;
+    const size_t NR = Micro::NR;
+    static_assert(SGEMM_MC % Micro::MR == 0, "SGEMM_MC has to be a multiple of the tile rows");
+
+    memset(c, 0, m * n * sizeof(float));
+    if (m == 0 || n == 0 || k == 0) {
+        return;
+    }
+
+    size_t packedBLength = roundUp(SGEMM_KC * roundUp(n < SGEMM_NC ? n : SGEMM_NC, NR), 16);
+    float * packedB = (float *) aligned_alloc(64, packedBLength * sizeof(float));
+
+    /* Every thread runs the jc and pc loops and packs its panels of A into its own buffer, which is
+     * allocated once. The implicit barriers of the omp for loops keep the shared panel of B intact
+     * until all threads are done with it. */
+    #pragma omp parallel num_threads(threads)
+    {
+        float * packedA = (float *) aligned_alloc(64, SGEMM_MC * SGEMM_KC * sizeof(float));
+        alignas(64) float edge[MR * NR];
+
+        for (size_t jc = 0; jc < n; jc += SGEMM_NC) {
+            size_t nc = (n - jc < SGEMM_NC) ? n - jc : SGEMM_NC;
+            for (size_t pc = 0; pc < k; pc += SGEMM_KC) {
+                size_t kc = (k - pc < SGEMM_KC) ? k - pc : SGEMM_KC;
+
+                #pragma omp for
+                for (size_t jr = 0; jr < nc; jr += NR) {
+                    size_t cols = (nc - jr < NR) ? nc - jr : NR;
+                    packPanelB(b + pc * n + jc + jr, n, kc, cols, NR, packedB + jr * kc);
+                }
+
+                #pragma omp for schedule(dynamic)
+                for (size_t ic = 0; ic < m; ic += SGEMM_MC) {
+                    size_t mc = (m - ic < SGEMM_MC) ? m - ic : SGEMM_MC;
+                    for (size_t ir = 0; ir < mc; ir += MR) {
+                        size_t rows = (mc - ir < MR) ? mc - ir : MR;
+                        packPanelA(a + (ic + ir) * k + pc, k, kc, rows, MR, packedA + ir * kc);
+                    }
+
+                    // The panel of B stays in the L1 cache while the panels of A pass by
+                    for (size_t jr = 0; jr < nc; jr += NR) {
+                        size_t cols = (nc - jr < NR) ? nc - jr : NR;
+                        for (size_t ir = 0; ir < mc; ir += MR) {
+                            size_t rows = (mc - ir < MR) ? mc - ir : MR;
+                            float * tile = c + (ic + ir) * n + jc + jr;
+
+                            if (rows == MR && cols == NR) {
+                                Micro::kernel(kc, packedA + ir * kc, packedB + jr * kc, tile, n);
+                                continue;
+                            }
+                            memset(edge, 0, sizeof(edge));
+                            Micro::kernel(kc, packedA + ir * kc, packedB + jr * kc, edge, NR);
+                            for (size_t r = 0; r < rows; r++) {
+                                for (size_t x = 0; x < cols; x++) {
+                                    tile[r * n + x] += edge[r * NR + x];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        free(packedA);
+    }
+
+    free(packedB);
+}
+
+
+struct SgemmMicroAVX2 {
+    static const size_t MR = 6;
+    static const size_t NR = 16;
+
+    static void kernel(size_t kc, const float * a, const float * b, float * c, size_t ldc) {
+        __m256 c00 = _mm256_loadu_ps(c);
+        __m256 c01 = _mm256_loadu_ps(c + 8);
+        __m256 c10 = _mm256_loadu_ps(c + ldc);
+        __m256 c11 = _mm256_loadu_ps(c + ldc + 8);
+        __m256 c20 = _mm256_loadu_ps(c + 2 * ldc);
+        __m256 c21 = _mm256_loadu_ps(c + 2 * ldc + 8);
+        __m256 c30 = _mm256_loadu_ps(c + 3 * ldc);
+        __m256 c31 = _mm256_loadu_ps(c + 3 * ldc + 8);
+        __m256 c40 = _mm256_loadu_ps(c + 4 * ldc);
+        __m256 c41 = _mm256_loadu_ps(c + 4 * ldc + 8);
+        __m256 c50 = _mm256_loadu_ps(c + 5 * ldc);
+        __m256 c51 = _mm256_loadu_ps(c + 5 * ldc + 8);
+
+        for (size_t p = 0; p < kc; p++) {
+            __m256 b0 = _mm256_load_ps(b);
+            __m256 b1 = _mm256_load_ps(b + 8);
+            __m256 ai;
+
+            ai = _mm256_broadcast_ss(a);
+            c00 = _mm256_fmadd_ps(ai, b0, c00);
+            c01 = _mm256_fmadd_ps(ai, b1, c01);
+            ai = _mm256_broadcast_ss(a + 1);
+            c10 = _mm256_fmadd_ps(ai, b0, c10);
+            c11 = _mm256_fmadd_ps(ai, b1, c11);
+            ai = _mm256_broadcast_ss(a + 2);
+            c20 = _mm256_fmadd_ps(ai, b0, c20);
+            c21 = _mm256_fmadd_ps(ai, b1, c21);
+            ai = _mm256_broadcast_ss(a + 3);
+            c30 = _mm256_fmadd_ps(ai, b0, c30);
+            c31 = _mm256_fmadd_ps(ai, b1, c31);
+            ai = _mm256_broadcast_ss(a + 4);
+            c40 = _mm256_fmadd_ps(ai, b0, c40);
+            c41 = _mm256_fmadd_ps(ai, b1, c41);
+            ai = _mm256_broadcast_ss(a + 5);
+            c50 = _mm256_fmadd_ps(ai, b0, c50);
+            c51 = _mm256_fmadd_ps(ai, b1, c51);
+
+            a += MR;
+            b += NR;
+        }
+
+        _mm256_storeu_ps(c, c00);
+        _mm256_storeu_ps(c + 8, c01);
+        _mm256_storeu_ps(c + ldc, c10);
+        _mm256_storeu_ps(c + ldc + 8, c11);
+        _mm256_storeu_ps(c + 2 * ldc, c20);
+        _mm256_storeu_ps(c + 2 * ldc + 8, c21);
+        _mm256_storeu_ps(c + 3 * ldc, c30);
+        _mm256_storeu_ps(c + 3 * ldc + 8, c31);
+        _mm256_storeu_ps(c + 4 * ldc, c40);
+        _mm256_storeu_ps(c + 4 * ldc + 8, c41);
+        _mm256_storeu_ps(c + 5 * ldc, c50);
+        _mm256_storeu_ps(c + 5 * ldc + 8, c51);
+    }
+};
+
+void sgemm_avx2(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads) {
+    sgemm_blocked<SgemmMicroAVX2>(a, b, c, m, n, k, threads);
+}
+
+
+HWY_BEFORE_NAMESPACE();
+struct SgemmMicroHighway {
+    static const size_t MR = 6;
+    static const size_t NR = 2 * HWY_LANES(float);
+
+    static HWY_ATTR void kernel(size_t kc, const float * a, const float * b, float * c, size_t ldc) {
+        using namespace hwy::HWY_NAMESPACE;
+        const ScalableTag<float> d;
+        // The packing uses NR, so the kernel takes its vector length from it as well
+        const size_t N = NR / 2;
+        assert(Lanes(d) == N);
+
+        auto c00 = LoadU(d, c);
+        auto c01 = LoadU(d, c + N);
+        auto c10 = LoadU(d, c + ldc);
+        auto c11 = LoadU(d, c + ldc + N);
+        auto c20 = LoadU(d, c + 2 * ldc);
+        auto c21 = LoadU(d, c + 2 * ldc + N);
+        auto c30 = LoadU(d, c + 3 * ldc);
+        auto c31 = LoadU(d, c + 3 * ldc + N);
+        auto c40 = LoadU(d, c + 4 * ldc);
+        auto c41 = LoadU(d, c + 4 * ldc + N);
+        auto c50 = LoadU(d, c + 5 * ldc);
+        auto c51 = LoadU(d, c + 5 * ldc + N);
+
+        for (size_t p = 0; p < kc; p++) {
+            const auto b0 = Load(d, b);
+            const auto b1 = Load(d, b + N);
+
+            auto ai = Set(d, a[0]);
+            c00 = MulAdd(ai, b0, c00);
+            c01 = MulAdd(ai, b1, c01);
+            ai = Set(d, a[1]);
+            c10 = MulAdd(ai, b0, c10);
+            c11 = MulAdd(ai, b1, c11);
+            ai = Set(d, a[2]);
+            c20 = MulAdd(ai, b0, c20);
+            c21 = MulAdd(ai, b1, c21);
+            ai = Set(d, a[3]);
+            c30 = MulAdd(ai, b0, c30);
+            c31 = MulAdd(ai, b1, c31);
+            ai = Set(d, a[4]);
+            c40 = MulAdd(ai, b0, c40);
+            c41 = MulAdd(ai, b1, c41);
+            ai = Set(d, a[5]);
+            c50 = MulAdd(ai, b0, c50);
+            c51 = MulAdd(ai, b1, c51);
+
+            a += MR;
+            b += NR;
+        }
+
+        StoreU(c00, d, c);
+        StoreU(c01, d, c + N);
+        StoreU(c10, d, c + ldc);
+        StoreU(c11, d, c + ldc + N);
+        StoreU(c20, d, c + 2 * ldc);
+        StoreU(c21, d, c + 2 * ldc + N);
+        StoreU(c30, d, c + 3 * ldc);
+        StoreU(c31, d, c + 3 * ldc + N);
+        StoreU(c40, d, c + 4 * ldc);
+        StoreU(c41, d, c + 4 * ldc + N);
+        StoreU(c50, d, c + 5 * ldc);
+        StoreU(c51, d, c + 5 * ldc + N);
+    }
+};
+HWY_AFTER_NAMESPACE();
+
+void sgemm_highway(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads) {
+    sgemm_blocked<SgemmMicroHighway>(a, b, c, m, n, k, threads);
+}
+
+
+struct SgemmMicroVc {
+    static const size_t MR = 6;
+    static const size_t NR = 2 * Vc::float_v::Size;
+
+    static void kernel(size_t kc, const float * a, const float * b, float * c, size_t ldc) {
+        const size_t N = Vc::float_v::Size;
+
+        Vc::float_v c00(c, Vc::Unaligned);
+        Vc::float_v c01(c + N, Vc::Unaligned);
+        Vc::float_v c10(c + ldc, Vc::Unaligned);
+        Vc::float_v c11(c + ldc + N, Vc::Unaligned);
+        Vc::float_v c20(c + 2 * ldc, Vc::Unaligned);
+        Vc::float_v c21(c + 2 * ldc + N, Vc::Unaligned);
+        Vc::float_v c30(c + 3 * ldc, Vc::Unaligned);
+        Vc::float_v c31(c + 3 * ldc + N, Vc::Unaligned);
+        Vc::float_v c40(c + 4 * ldc, Vc::Unaligned);
+        Vc::float_v c41(c + 4 * ldc + N, Vc::Unaligned);
+        Vc::float_v c50(c + 5 * ldc, Vc::Unaligned);
+        Vc::float_v c51(c + 5 * ldc + N, Vc::Unaligned);
+
+        for (size_t p = 0; p < kc; p++) {
+            Vc::float_v b0(b, Vc::Aligned);
+            Vc::float_v b1(b + N, Vc::Aligned);
+
+            Vc::float_v ai(a[0]);
+            c00 += ai * b0;
+            c01 += ai * b1;
+            ai = Vc::float_v(a[1]);
+            c10 += ai * b0;
+            c11 += ai * b1;
+            ai = Vc::float_v(a[2]);
+            c20 += ai * b0;
+            c21 += ai * b1;
+            ai = Vc::float_v(a[3]);
+            c30 += ai * b0;
+            c31 += ai * b1;
+            ai = Vc::float_v(a[4]);
+            c40 += ai * b0;
+            c41 += ai * b1;
+            ai = Vc::float_v(a[5]);
+            c50 += ai * b0;
+            c51 += ai * b1;
+
+            a += MR;
+            b += NR;
+        }
+
+        c00.store(c, Vc::Unaligned);
+        c01.store(c + N, Vc::Unaligned);
+        c10.store(c + ldc, Vc::Unaligned);
+        c11.store(c + ldc + N, Vc::Unaligned);
+        c20.store(c + 2 * ldc, Vc::Unaligned);
+        c21.store(c + 2 * ldc + N, Vc::Unaligned);
+        c30.store(c + 3 * ldc, Vc::Unaligned);
+        c31.store(c + 3 * ldc + N, Vc::Unaligned);
+        c40.store(c + 4 * ldc, Vc::Unaligned);
+        c41.store(c + 4 * ldc + N, Vc::Unaligned);
+        c50.store(c + 5 * ldc, Vc::Unaligned);
+        c51.store(c + 5 * ldc + N, Vc::Unaligned);
+    }
+};
+
+void sgemm_vc(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads) {
+    sgemm_blocked<SgemmMicroVc>(a, b, c, m, n, k, threads);
+}
+
+
+struct SgemmMicroLibsimdpp {
+    static const size_t MR = 6;
+    static const size_t NR = 2 * SIMDPP_FAST_FLOAT32_SIZE;
+
+    static void kernel(size_t kc, const float * a, const float * b, float * c, size_t ldc) {
+        using namespace simdpp;
+        const size_t N = SIMDPP_FAST_FLOAT32_SIZE;
+
+        float32<N> c00 = load_u(c);
+        float32<N> c01 = load_u(c + N);
+        float32<N> c10 = load_u(c + ldc);
+        float32<N> c11 = load_u(c + ldc + N);
+        float32<N> c20 = load_u(c + 2 * ldc);
+        float32<N> c21 = load_u(c + 2 * ldc + N);
+        float32<N> c30 = load_u(c + 3 * ldc);
+        float32<N> c31 = load_u(c + 3 * ldc + N);
+        float32<N> c40 = load_u(c + 4 * ldc);
+        float32<N> c41 = load_u(c + 4 * ldc + N);
+        float32<N> c50 = load_u(c + 5 * ldc);
+        float32<N> c51 = load_u(c + 5 * ldc + N);
+
+        for (size_t p = 0; p < kc; p++) {
+            float32<N> b0 = load(b);
+            float32<N> b1 = load(b + N);
+
+            float32<N> ai = splat(a[0]);
+            c00 = fmadd(ai, b0, c00);
+            c01 = fmadd(ai, b1, c01);
+            ai = splat(a[1]);
+            c10 = fmadd(ai, b0, c10);
+            c11 = fmadd(ai, b1, c11);
+            ai = splat(a[2]);
+            c20 = fmadd(ai, b0, c20);
+            c21 = fmadd(ai, b1, c21);
+            ai = splat(a[3]);
+            c30 = fmadd(ai, b0, c30);
+            c31 = fmadd(ai, b1, c31);
+            ai = splat(a[4]);
+            c40 = fmadd(ai, b0, c40);
+            c41 = fmadd(ai, b1, c41);
+            ai = splat(a[5]);
+            c50 = fmadd(ai, b0, c50);
+            c51 = fmadd(ai, b1, c51);
+
+            a += MR;
+            b += NR;
+        }
+
+        store_u(c, c00);
+        store_u(c + N, c01);
+        store_u(c + ldc, c10);
+        store_u(c + ldc + N, c11);
+        store_u(c + 2 * ldc, c20);
+        store_u(c + 2 * ldc + N, c21);
+        store_u(c + 3 * ldc, c30);
+        store_u(c + 3 * ldc + N, c31);
+        store_u(c + 4 * ldc, c40);
+        store_u(c + 4 * ldc + N, c41);
+        store_u(c + 5 * ldc, c50);
+        store_u(c + 5 * ldc + N, c51);
+    }
+};
+
+void sgemm_libsimdpp(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads) {
+    sgemm_blocked<SgemmMicroLibsimdpp>(a, b, c, m, n, k, threads);
+}
+
+
+/* pure_simd has no stores, the lanes are written one by one */
+template <typename V>
+static inline void store_pure_simd(float * p, const V & v, size_t lanes) {
+    for (size_t x = 0; x < lanes; x++) {
+        p[x] = v[x];
+    }
+}
+
+struct SgemmMicroPureSimd {
+    static const size_t MR = 6;
+    static const size_t NR = 16;
+
+    static void kernel(size_t kc, const float * a, const float * b, float * c, size_t ldc) {
+        using namespace pure_simd;
+        const size_t VECTOR_SIZE = 8;
+        using TargetVec = vector<float, VECTOR_SIZE>;
+
+        auto c00 = load_from<TargetVec>(c);
+        auto c01 = load_from<TargetVec>(c + VECTOR_SIZE);
+        auto c10 = load_from<TargetVec>(c + ldc);
+        auto c11 = load_from<TargetVec>(c + ldc + VECTOR_SIZE);
+        auto c20 = load_from<TargetVec>(c + 2 * ldc);
+        auto c21 = load_from<TargetVec>(c + 2 * ldc + VECTOR_SIZE);
+        auto c30 = load_from<TargetVec>(c + 3 * ldc);
+        auto c31 = load_from<TargetVec>(c + 3 * ldc + VECTOR_SIZE);
+        auto c40 = load_from<TargetVec>(c + 4 * ldc);
+        auto c41 = load_from<TargetVec>(c + 4 * ldc + VECTOR_SIZE);
+        auto c50 = load_from<TargetVec>(c + 5 * ldc);
+        auto c51 = load_from<TargetVec>(c + 5 * ldc + VECTOR_SIZE);
+
+        for (size_t p = 0; p < kc; p++) {
+            auto b0 = load_from<TargetVec>(b);
+            auto b1 = load_from<TargetVec>(b + VECTOR_SIZE);
+
+            auto ai = scalar<TargetVec>(a[0]);
+            c00 = (ai * b0) + c00;
+            c01 = (ai * b1) + c01;
+            ai = scalar<TargetVec>(a[1]);
+            c10 = (ai * b0) + c10;
+            c11 = (ai * b1) + c11;
+            ai = scalar<TargetVec>(a[2]);
+            c20 = (ai * b0) + c20;
+            c21 = (ai * b1) + c21;
+            ai = scalar<TargetVec>(a[3]);
+            c30 = (ai * b0) + c30;
+            c31 = (ai * b1) + c31;
+            ai = scalar<TargetVec>(a[4]);
+            c40 = (ai * b0) + c40;
+            c41 = (ai * b1) + c41;
+            ai = scalar<TargetVec>(a[5]);
+            c50 = (ai * b0) + c50;
+            c51 = (ai * b1) + c51;
+
+            a += MR;
+            b += NR;
+        }
+
+        store_pure_simd(c, c00, VECTOR_SIZE);
+        store_pure_simd(c + VECTOR_SIZE, c01, VECTOR_SIZE);
+        store_pure_simd(c + ldc, c10, VECTOR_SIZE);
+        store_pure_simd(c + ldc + VECTOR_SIZE, c11, VECTOR_SIZE);
+        store_pure_simd(c + 2 * ldc, c20, VECTOR_SIZE);
+        store_pure_simd(c + 2 * ldc + VECTOR_SIZE, c21, VECTOR_SIZE);
+        store_pure_simd(c + 3 * ldc, c30, VECTOR_SIZE);
+        store_pure_simd(c + 3 * ldc + VECTOR_SIZE, c31, VECTOR_SIZE);
+        store_pure_simd(c + 4 * ldc, c40, VECTOR_SIZE);
+        store_pure_simd(c + 4 * ldc + VECTOR_SIZE, c41, VECTOR_SIZE);
+        store_pure_simd(c + 5 * ldc, c50, VECTOR_SIZE);
+        store_pure_simd(c + 5 * ldc + VECTOR_SIZE, c51, VECTOR_SIZE);
+    }
+};
+
+void sgemm_pure_simd(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads) {
+    sgemm_blocked<SgemmMicroPureSimd>(a, b, c, m, n, k, threads);
+}
+
+
+size_t sgemm_tile_width(SgemmKernel kernel) {
+    if (kernel == sgemm_avx2) {
+        return SgemmMicroAVX2::NR;
+    } else if (kernel == sgemm_highway) {
+        return SgemmMicroHighway::NR;
+    } else if (kernel == sgemm_vc) {
+        return SgemmMicroVc::NR;
+    } else if (kernel == sgemm_libsimdpp) {
+        return SgemmMicroLibsimdpp::NR;
+    } else if (kernel == sgemm_pure_simd) {
+        return SgemmMicroPureSimd::NR;
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+#ifndef matrixMultiply
+#define matrixMultiply
+
+#include <stdlib.h>
+
+/* Single precision matrix multiplication C = A * B. A is m x k, B is k x n and C is m x n, all
+ * stored row major and contiguous. The blocked versions pack panels of A and B into contiguous
+ * buffers, SGEMM_KC x SGEMM_NC of B for the last level cache, SGEMM_MC x SGEMM_KC of A for the L2
+ * cache, and a micro-kernel keeps a tile of 6 rows and 2 vectors of C in registers while it walks
+ * through one panel of each. The blocks of rows are distributed over the threads with OpenMP.
+ * The micro-kernels are written once per library, the packing and the loops around are shared. */
+
+// Cache blocking of the packed panels, SGEMM_MC has to be a multiple of the 6 rows of a tile
+#define SGEMM_MC 96
+#define SGEMM_KC 256
+#define SGEMM_NC 4096
+
+/**
+ * A matrix multiplication with the signature of the blocked versions.
+*/
+typedef void (*SgemmKernel)(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads);
+
+/**
+ * Multiplies two matrices with the textbook triple loop, the reference for the others.
+ *
+ * @param a
+ *          The left matrix, m x k (float array)
+ * @param b
+ *          The right matrix, k x n (float array)
+ * @param c
+ *          The result, m x n (float array)
+ * @param m
+ *          The number of rows of a and c
+ * @param n
+ *          The number of columns of b and c
+ * @param k
+ *          The number of columns of a and rows of b
+*/
+void sgemm_naive(float * a, float * b, float * c, size_t m, size_t n, size_t k);
+
+
+/**
+ * Multiplies two matrices, blocked with an AVX2 intrinsics micro-kernel of 6 x 16 floats.
+ *
+ * @param a
+ *          The left matrix, m x k (float array)
+ * @param b
+ *          The right matrix, k x n (float array)
+ * @param c
+ *          The result, m x n (float array)
+ * @param m
+ *          The number of rows of a and c
+ * @param n
+ *          The number of columns of b and c
+ * @param k
+ *          The number of columns of a and rows of b
+ * @param threads
+ *          The number of threads
+*/
+void sgemm_avx2(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads);
+
+
+/**
+ * Multiplies two matrices, blocked with a Highway micro-kernel of 6 rows and 2 vectors of the
+ *  static target.
+ *
+ * @param a
+ *          The left matrix, m x k (float array)
+ * @param b
+ *          The right matrix, k x n (float array)
+ * @param c
+ *          The result, m x n (float array)
+ * @param m
+ *          The number of rows of a and c
+ * @param n
+ *          The number of columns of b and c
+ * @param k
+ *          The number of columns of a and rows of b
+ * @param threads
+ *          The number of threads
+*/
+void sgemm_highway(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads);
+
+
+/**
+ * Multiplies two matrices, blocked with a Vc micro-kernel of 6 rows and 2 float_v.
+ *
+ * @param a
+ *          The left matrix, m x k (float array)
+ * @param b
+ *          The right matrix, k x n (float array)
+ * @param c
+ *          The result, m x n (float array)
+ * @param m
+ *          The number of rows of a and c
+ * @param n
+ *          The number of columns of b and c
+ * @param k
+ *          The number of columns of a and rows of b
+ * @param threads
+ *          The number of threads
+*/
+void sgemm_vc(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads);
+
+
+/**
+ * Multiplies two matrices, blocked with a libsimdpp micro-kernel of 6 rows and 2 vectors of
+ *  SIMDPP_FAST_FLOAT32_SIZE floats.
+ *
+ * @param a
+ *          The left matrix, m x k (float array)
+ * @param b
+ *          The right matrix, k x n (float array)
+ * @param c
+ *          The result, m x n (float array)
+ * @param m
+ *          The number of rows of a and c
+ * @param n
+ *          The number of columns of b and c
+ * @param k
+ *          The number of columns of a and rows of b
+ * @param threads
+ *          The number of threads
+*/
+void sgemm_libsimdpp(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads);
+
+
+/**
+ * Multiplies two matrices, blocked with a pure_simd micro-kernel of 6 rows and 2 vectors of 8
+ *  floats.
+ *
+ * @param a
+ *          The left matrix, m x k (float array)
+ * @param b
+ *          The right matrix, k x n (float array)
+ * @param c
+ *          The result, m x n (float array)
+ * @param m
+ *          The number of rows of a and c
+ * @param n
+ *          The number of columns of b and c
+ * @param k
+ *          The number of columns of a and rows of b
+ * @param threads
+ *          The number of threads
+*/
+void sgemm_pure_simd(float * a, float * b, float * c, size_t m, size_t n, size_t k, size_t threads);
+
+
+/**
+ * Returns the number of columns NR of the micro-kernel tile of a blocked version, two vectors of
+ *  the library it was compiled with.
+ *
+ * @param kernel
+ *          One of the blocked versions above
+ *
+ * @return  The width of the tile, 0 for other functions
+*/
+size_t sgemm_tile_width(SgemmKernel kernel);
+
+#endif  // matrixMultiply
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <benchmark/benchmark.h>
+#include "hwy/aligned_allocator.h"
+
+#include "matrixMultiply.hpp"
+#include "../utils/utils.hpp"
+
+using std::chrono::high_resolution_clock;
+using std::chrono::duration;
+
+/* The theoretical peak of the used cores: clock x 2 FMA units x 2 FLOP per FMA x float lanes of
+ * the measured micro-kernel. The clock is the maximum frequency of cpu0, or the current one from
+ * /proc/cpuinfo where cpufreq is not available. Hyperthreads share the FMA units of their core, so the peak is too high for
+ * thread counts beyond the physical cores. */
+static double peakGflops(size_t threads, size_t lanes) {
+    double ghz = 0;
+    std::ifstream maxFrequency("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq");
+    double khz;
+    if (maxFrequency >> khz) {
+        ghz = khz / 1e6;
+    } else {
+        std::ifstream cpuinfo("/proc/cpuinfo");
+        std::string line;
+        while (std::getline(cpuinfo, line)) {
+            if (line.rfind("cpu MHz", 0) == 0) {
+                ghz = std::stod(line.substr(line.find(':') + 1)) / 1000;
+                break;
+            }
+        }
+    }
+
+    size_t cores = std::min<size_t>(threads, std::max(1u, std::thread::hardware_concurrency()));
+    return cores * ghz * 2 * 2 * lanes;
+}
+
+/* Square matrices from 256, which fit the L2 cache, to 2048, which do not fit the last level
+ * cache, each with powers of 2 up to all hardware threads */
+static void SgemmArguments(benchmark::internal::Benchmark* b) {
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int size : {256, 512, 1024, 2048}) {
+        for (int threads = 1; threads < maxThreads; threads *= 2) {
+            b->Args({size, threads});
+        }
+        b->Args({size, maxThreads});
+    }
+}
+
+static void setSgemmCounters(benchmark::State& state, size_t size, size_t threads, size_t lanes, double seconds) {
+    double flop = 2.0 * size * size * size * state.iterations();
+    state.counters["GFLOP"] = benchmark::Counter(flop / 1e9, benchmark::Counter::kIsRate);
+    double peak = peakGflops(threads, lanes);
+    if (peak > 0) {
+        state.counters["%peak"] = 100 * (flop / seconds / 1e9) / peak;
+    }
+}
+
+static void BM_Sgemm_Naive(benchmark::State& state) {
+    size_t size = state.range(0);
+
+    hwy::AlignedFreeUniquePtr<float []> a = hwy::AllocateAligned<float>(size * size);
+    hwy::AlignedFreeUniquePtr<float []> b = hwy::AllocateAligned<float>(size * size);
+    hwy::AlignedFreeUniquePtr<float []> c = hwy::AllocateAligned<float>(size * size);
+    fillFloatArrayRandom(a.get(), size * size);
+    fillFloatArrayRandom(b.get(), size * size);
+
+    auto start = high_resolution_clock::now();
+    for (auto _ : state) {
+        sgemm_naive(a.get(), b.get(), c.get(), size, size, size);
+        benchmark::ClobberMemory();
+    }
+    duration<double> elapsed = high_resolution_clock::now() - start;
+    // The triple loop is measured against the peak of the AVX2 vectors
+    setSgemmCounters(state, size, 1, sgemm_tile_width(sgemm_avx2) / 2, elapsed.count());
+}
+BENCHMARK(BM_Sgemm_Naive)->Arg(256)->Arg(512)->Unit(benchmark::kMillisecond);
+
+template <typename Sgemm>
+static void BM_Sgemm(benchmark::State& state, Sgemm kernel) {
+    size_t size = state.range(0);
+    size_t threads = state.range(1);
+
+    hwy::AlignedFreeUniquePtr<float []> a = hwy::AllocateAligned<float>(size * size);
+    hwy::AlignedFreeUniquePtr<float []> b = hwy::AllocateAligned<float>(size * size);
+    hwy::AlignedFreeUniquePtr<float []> c = hwy::AllocateAligned<float>(size * size);
+    fillFloatArrayRandom(a.get(), size * size);
+    fillFloatArrayRandom(b.get(), size * size);
+
+    auto start = high_resolution_clock::now();
+    for (auto _ : state) {
+        kernel(a.get(), b.get(), c.get(), size, size, size, threads);
+        benchmark::ClobberMemory();
+    }
+    duration<double> elapsed = high_resolution_clock::now() - start;
+    // A tile of the micro-kernel is 2 vectors wide
+    setSgemmCounters(state, size, threads, sgemm_tile_width(kernel) / 2, elapsed.count());
+}
+BENCHMARK_CAPTURE(BM_Sgemm, AVX2, sgemm_avx2)
+    ->Apply(SgemmArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Sgemm, Highway, sgemm_highway)
+    ->Apply(SgemmArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Sgemm, Vc, sgemm_vc)
+    ->Apply(SgemmArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Sgemm, Libsimdpp, sgemm_libsimdpp)
+    ->Apply(SgemmArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Sgemm, Pure_Simd, sgemm_pure_simd)
+    ->Apply(SgemmArguments)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,9 +1,15 @@
 #include <iostream>
 #include <assert.h>
+#include <math.h>
 #include <numeric>
+#include <vector>
 
 #include "../dotProduct/dotProduct.hpp"
 #include "../dotProduct/dotProductHighway.hpp"
+#include "../dotProduct/dotProductDispatch.hpp"
+#include "../dotProduct/dotProductThreaded.hpp"
+#include "../dotProduct/dotProductBatched.hpp"
+#include "../dotProduct/dotProductAccurate.hpp"
 #include "../utils/utils.hpp"
 
 void dot_product_unrolled_test(float * a, float *b, size_t length, float expected) {
@@ -66,6 +72,18 @@ void dot_product_vc_unrolled_test(float * a, float * b, size_t length, float exp
     std::cout << "dot_product_vc_unrolled \tPASSED" << std::endl;
 }
 
+void highway_dot_product_dispatch_test(float * a, float * b, size_t length, float expected) {
+    float result = highway_dot_product_dispatch(a, b, length);
+    assert(result == expected);
+    std::cout << "highway_dot_product_dispatch \tPASSED (" << highway_dot_product_dispatch_target() << ")" << std::endl;
+}
+
+void dot_product_intrinsics_dispatch_test(float * a, float * b, size_t length, float expected) {
+    float result = dot_product_intrinsics_dispatch(a, b, length);
+    assert(result == expected);
+    std::cout << "dot_product_intrinsics_dispatch PASSED (" << dot_product_intrinsics_dispatch_target() << ")" << std::endl;
+}
+
 #ifdef AVX512
 void dot_product_avx512_test(float * a, float * b, size_t length, float expected) {
     float result = dot_product_avx512(a, b, length);
@@ -81,6 +99,155 @@ void dot_product_avx512_unrolled_test(float * a, float * b, size_t length, float
 #endif
 
 
+/* Every length up to 100 at every offset within a 64 byte line. The products of the small
+ * integers and their sums are exact in float, so all implementations have to agree exactly. */
+template <typename DotProduct>
+void dot_product_tail_test(const char * name, DotProduct kernel) {
+    const size_t maxLength = 100;
+    __attribute__((aligned(64))) float a[maxLength + 16];
+    __attribute__((aligned(64))) float b[maxLength + 16];
+    std::iota(a, a + maxLength + 16, 1);
+    for (size_t i = 0; i < maxLength + 16; i++) {
+        b[i] = (float) (i % 7);
+    }
+
+    for (size_t offset = 0; offset < 16; offset++) {
+        for (size_t length = 0; length <= maxLength; length++) {
+            float expected = dot_product(a + offset, b + offset, length);
+            assert(kernel(a + offset, b + offset, length) == expected);
+        }
+    }
+    std::cout << name << " (tails)\tPASSED" << std::endl;
+}
+
+
+/* Several chunks and a partial one. The partial sums stay exact in float and their total in
+ * double, and the chunks are combined in order, so every thread count has to give the same
+ * result. */
+void dot_product_threaded_test(DotProductKernel kernel, const char * name) {
+    const size_t length = 5 * DOT_CHUNK_LENGTH + 13;
+    std::vector<float> a(length);
+    std::vector<float> b(length);
+    double expected = 0;
+    for (size_t i = 0; i < length; i++) {
+        a[i] = (float) (i % 8);
+        b[i] = (float) (i % 3);
+        expected += a[i] * b[i];
+    }
+
+    float single = dot_product_threaded(kernel, a.data(), b.data(), length, 1);
+    assert(single == (float) expected);
+    for (size_t threads = 2; threads <= 8; threads++) {
+        assert(dot_product_threaded(kernel, a.data(), b.data(), length, threads) == single);
+    }
+    assert(dot_product_threaded(kernel, a.data(), b.data(), 100, 4) == kernel(a.data(), b.data(), 100));
+    std::cout << "dot_product_threaded (" << name << ")\tPASSED" << std::endl;
+}
+
+
+/* Row and query counts around the block sizes and beyond one row tile, with lengths around the
+ * vector width. The small integers keep every sum exact, so the batched results have to equal the
+ * single dot products. */
+void dot_product_batched_test() {
+    for (size_t length : {0, 1, 7, 8, 9, 31, 64, 100}) {
+        for (size_t rows : {0, 1, 3, 4, 7, 8, 9, 17, 333}) {
+            std::vector<float> matrix(rows * length);
+            std::vector<float> queries(3 * length);
+            for (size_t i = 0; i < matrix.size(); i++) {
+                matrix[i] = (float) (i % 8);
+            }
+            for (size_t i = 0; i < queries.size(); i++) {
+                queries[i] = (float) (i % 3);
+            }
+
+            std::vector<float> result(rows);
+            dot_product_batched_AVX2(matrix.data(), rows, length, queries.data(), result.data());
+            for (size_t r = 0; r < rows; r++) {
+                assert(result[r] == dot_product(&matrix[r * length], queries.data(), length));
+            }
+
+            for (size_t queryCount = 1; queryCount <= 3; queryCount++) {
+                std::vector<float> results(queryCount * rows);
+                dot_product_batched_queries_AVX2(matrix.data(), rows, length, queries.data(), queryCount,
+                                                 results.data());
+                for (size_t q = 0; q < queryCount; q++) {
+                    for (size_t r = 0; r < rows; r++) {
+                        assert(results[q * rows + r] == dot_product(&matrix[r * length], &queries[q * length], length));
+                    }
+                }
+            }
+        }
+    }
+    std::cout << "dot_product_batched_AVX2 \tPASSED" << std::endl;
+    std::cout << "dot_product_batched_queries_AVX2 \tPASSED" << std::endl;
+}
+
+
+/* The error of a kernel relative to the sum of the absolute products, which its bound scales.
+ * Products of floats are exact in double, their sum in long double is exact enough as reference. */
+template <typename DotProduct>
+double dot_product_error(DotProduct kernel, std::vector<float> & a, std::vector<float> & b, double & relative) {
+    long double exact = 0;
+    long double sumAbs = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        double product = (double) a[i] * b[i];
+        exact += product;
+        sumAbs += fabs(product);
+    }
+    double error = fabs((double) (kernel(a.data(), b.data(), a.size()) - exact));
+    relative = error / fabs((double) exact);
+    return error / (double) sumAbs;
+}
+
+/* Long vectors of random positive terms, then pairs of large terms that almost cancel, with a
+ * condition number of several thousand. The compensated version has to be within about an ulp of
+ * the exact result in both cases, the pairwise one within its documented bound. The error of the
+ * plain unrolled kernel is printed for comparison. */
+void dot_product_accuracy_test() {
+    const size_t length = 1 << 20;
+    const double u = ldexp(1.0, -24);
+    const double pairwiseRoundings = PAIRWISE_BLOCK / 32 + 9 + ceil(log2((double) length / PAIRWISE_BLOCK));
+    const double pairwiseBound = pairwiseRoundings * u / (1 - pairwiseRoundings * u);
+
+    std::vector<float> a(length);
+    std::vector<float> b(length);
+    for (int conditioned = 0; conditioned < 2; conditioned++) {
+        srand(42);
+        for (size_t i = 0; i < length; i += 2) {
+            float r0 = rand() / (float) RAND_MAX;
+            float r1 = rand() / (float) RAND_MAX;
+            float r2 = rand() / (float) RAND_MAX;
+            if (conditioned == 0) {
+                a[i] = r0;
+                b[i] = r1;
+                a[i + 1] = r2;
+                b[i + 1] = r0;
+            } else {
+                a[i] = 1000 * r0;
+                b[i] = r1;
+                a[i + 1] = a[i];
+                b[i + 1] = -r1 + 0.001f * r2;
+            }
+        }
+
+        double relative;
+        double plainError = dot_product_error(dot_product_AVX2_unrolled, a, b, relative);
+        double plainRelative = relative;
+        double compensatedError = dot_product_error(dot_product_compensated_AVX2, a, b, relative);
+        assert(relative <= 2 * u);
+        double compensatedRelative = relative;
+        double pairwiseError = dot_product_error(dot_product_pairwise_AVX2, a, b, relative);
+        assert(pairwiseError <= pairwiseBound);
+
+        std::cout << (conditioned ? "cancelling" : "positive") << " terms, error / sum |a_i * b_i|: unrolled "
+                  << plainError << ", compensated " << compensatedError << ", pairwise " << pairwiseError
+                  << "; relative: unrolled " << plainRelative << ", compensated " << compensatedRelative << std::endl;
+    }
+    std::cout << "dot_product_compensated_AVX2 (accuracy)\tPASSED" << std::endl;
+    std::cout << "dot_product_pairwise_AVX2 (accuracy)\tPASSED" << std::endl;
+}
+
+
 int main () {
     size_t length = 64;
     __attribute__((aligned(64))) float a[length]; 
@@ -103,10 +270,35 @@ int main () {
     dot_product_pure_simd_test(a, b, length, result);
     dot_product_vc_test(a, b, length, result);
     dot_product_vc_unrolled_test(a, b, length, result);
+    highway_dot_product_dispatch_test(a, b, length, result);
+    dot_product_intrinsics_dispatch_test(a, b, length, result);
+
+    dot_product_tail_test("dot_product_unrolled", dot_product_unrolled);
+    dot_product_tail_test("dot_product_AVX2", dot_product_AVX2);
+    dot_product_tail_test("dot_product_AVX2_unrolled", dot_product_AVX2_unrolled);
+    dot_product_tail_test("dot_product_libsimdpp", dot_product_libsimdpp);
+    dot_product_tail_test("dot_product_libsimdpp_unrolled", dot_product_libsimdpp_unrolled);
+    dot_product_tail_test("dot_product_pure_simd", dot_product_pure_simd);
+    dot_product_tail_test("dot_product_vc", dot_product_vc);
+    dot_product_tail_test("dot_product_vc_unrolled", dot_product_vc_unrolled);
+    dot_product_tail_test("highway_dot_product", highway_dot_product);
+    dot_product_tail_test("highway_dot_product_unrolled", highway_dot_product_unrolled);
+    dot_product_tail_test("highway_dot_product_dispatch", highway_dot_product_dispatch);
+    dot_product_tail_test("dot_product_intrinsics_dispatch", dot_product_intrinsics_dispatch);
+
+    dot_product_threaded_test(dot_product_AVX2_unrolled, "dot_product_AVX2_unrolled");
+    dot_product_threaded_test(dot_product_intrinsics_dispatch, "dot_product_intrinsics_dispatch");
+    dot_product_batched_test();
+
+    dot_product_tail_test("dot_product_compensated_AVX2", dot_product_compensated_AVX2);
+    dot_product_tail_test("dot_product_pairwise_AVX2", dot_product_pairwise_AVX2);
+    dot_product_accuracy_test();
 
 #ifdef AVX512
     dot_product_avx512_test(a, b, length, result);
     dot_product_avx512_unrolled_test(a, b, length, result);
+    dot_product_tail_test("dot_product_avx512", dot_product_avx512);
+    dot_product_tail_test("dot_product_avx512_unrolled", dot_product_avx512_unrolled);
 #endif
 }
 
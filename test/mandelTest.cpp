@@ -1,5 +1,9 @@
 #include <iostream>
 #include <chrono>
+#include <assert.h>
+#include <algorithm>
+#include <math.h>
+#include <stdlib.h>
 
 #ifndef SVE
 #include "hwy/aligned_allocator.h"
@@ -8,10 +12,28 @@
 #endif 	// SVE
 
 #include "../mandelbrot/mandelbrot.hpp"
+#include "../mandelbrot/mandelbrotThreaded.hpp"
+#include "../mandelbrot/mandelbrotSubdivision.hpp"
+#include "../mandelbrot/mandelbrotIterations.hpp"
+#include "../mandelbrot/mandelbrotPacked.hpp"
+#include "../mandelbrot/mandelbrotInterleaved.hpp"
+#include "../mandelbrot/mandelbrotDispatch.hpp"
+#include "../mandelbrot/mandelbrotRegistry.hpp"
+#include "../mandelbrot/mandelbrotDouble.hpp"
+#include "../mandelbrot/mandelbrotPerturbation.hpp"
+#include "../mandelbrot/mandelbrotPeriodicity.hpp"
+#include "../mandelbrot/mandelbrotSettings.hpp"
+#include "../mandelbrot/mandelbrotSmooth.hpp"
+#include "../mandelbrot/mandelbrotColor.hpp"
+#include "../mandelbrot/mandelbrotStats.hpp"
+#include "../mandelbrot/mandelbrotEscapeTime.hpp"
+#include "../mandelbrot/mandelbrotComplex.hpp"
 #include "../mandelbrot/nsimdMandelbrot.hpp"
 #include "../mandelbrot/nsimdBaseMandelbrot.hpp"
 #include "../mandelbrot/simdeMandelbrot.hpp"
 #include "../utils/utils.hpp"
+#include "../utils/imageWriter.hpp"
+#include "../utils/vecComplex.hpp"
 
 
 using std::chrono::high_resolution_clock;
@@ -19,6 +41,28 @@ using std::chrono::duration;
 
 using namespace std; 
 
+#ifndef SVE
+static size_t countDifferences(const float * image, const float * referenceImage, const size_t width, const size_t height) {
+    size_t differences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        differences += (image[i] != referenceImage[i]);
+    }
+    return differences;
+}
+
+/* The reference images mandelbrot_highway.pbm and mandelbrot_AVX2.pbm in test/images/ are fixtures
+ * of the repository, no test writes them. They were rendered by one build of the kernels, another
+ * compiler may contract the orbit differently, which flips a few pixels on the boarder of the set. */
+static void assertMatchesReference(const float * image, const size_t width, const size_t height, const char * reference) {
+    hwy::AlignedFreeUniquePtr<float []> referenceImage = hwy::AllocateAligned<float>(width * height);
+    bool read = readBitmapImage(width, height, &referenceImage[0], reference);
+    assert(read);
+    (void) read;
+
+    assert(countDifferences(image, &referenceImage[0], width, height) <= (width * height) / 5000);
+}
+#endif
+
 void runMandelbrotClassic(const size_t width, const size_t height) {
     float image[width * height];
 
@@ -35,12 +79,570 @@ void runHighway(const size_t width, const size_t height) {
 
     mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
 
-    char name[23] = "mandelbrot_highway.pbm";
+    // The reference stays untouched, the render is written next to it
+    assertMatchesReference(&image[0], width, height, "mandelbrot_highway.pbm");
+    char name[27] = "mandelbrot_highway_out.pbm";
     createBitmapImage(width, height, &image[0], name);
     std::cout << name <<":\t\tCOMPLETED" << std::endl;
 }
 #endif
 
+#ifndef SVE
+void runHighwayRefill(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageRefill = hwy::AllocateAligned<float>(width * height);
+
+    // Refilled lanes compute the same pixels, only in a different order
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_highway_refill(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageRefill[0]);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageRefill[i]);
+    }
+
+    for (int maxIterations : {5, 1001}) {
+        mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], maxIterations, BAILOUT);
+        mandelbrot_highway_refill(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageRefill[0], maxIterations, BAILOUT);
+        for (size_t i = 0; i < width * height; i++) {
+            assert(image[i] == imageRefill[i]);
+        }
+    }
+
+    char name[30] = "mandelbrot_highway_refill.pbm";
+    createBitmapImage(width, height, &imageRefill[0], name);
+    std::cout << "mandelbrot_highway_refill:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runHighwayIterations(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_highway_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+
+    for (size_t i = 0; i < width * height; i++) {
+        assert((image[i] == 1.0f) == (iterations[i] == MAX_ITERATIONS + 1));
+    }
+    writeGraymapImage("test/images/mandelbrot_highway_iterations.pgm", width, height, &iterations[0], MAX_ITERATIONS + 1);
+    std::cout << "mandelbrot_highway_iterations:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+/* Scalar continuous escape count in double precision, the orbit itself is computed in float like in the kernels */
+static double smoothReference(float c_real, float c_imag) {
+    float z_real = 0;
+    float z_imag = 0;
+    for (int iteration = 1; iteration <= MAX_ITERATIONS + 1; iteration++) {
+        float z_real_squared = z_real * z_real;
+        float z_imag_squared = z_imag * z_imag;
+        float temp = z_real * z_imag;
+        z_real = (z_real_squared - z_imag_squared) + c_real;
+        z_imag = (temp + temp) + c_imag;
+
+        float norm = z_real_squared + z_imag_squared;
+        if (!(norm < SMOOTH_BAILOUT)) {
+            return iteration - log2(0.5 * log2(norm));
+        }
+    }
+    return MAX_ITERATIONS + 1;
+}
+
+/* Lanes close to the boarder may round their orbits differently, at most 2% of the pixels may differ */
+static void checkSmooth(const char * name, const float * smooth, const size_t width, const size_t height, float xOffset) {
+    float xScale = 2.25f / width;
+    float yScale = 2.25f / height;
+    size_t differences = 0;
+    for (size_t j = 0; j < height; j++) {
+        for (size_t i = 0; i < width; i++) {
+            double reference = smoothReference(fmaf(i + xOffset, xScale, -1.5f), -1.125f + j * yScale);
+            differences += fabs(reference - smooth[(j * width) + i]) > 1e-3;
+        }
+    }
+    assert(differences < (width * height) / 50);
+    std::cout << name << ":\tPASSED" << std::endl;
+}
+
+void runHighwaySmooth(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_highway_smooth(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &smooth[0]);
+    checkSmooth("mandelbrot_highway_smooth", &smooth[0], width, height, 0.0f);
+}
+#endif
+
+#ifndef SVE
+/* The polynomial palette in float with nearest rounding, the kernels may contract to FMA and differ by one */
+static void checkSmoothColors(const char * name, const float * smooth, const uint8_t * rgb, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float t = std::min(std::max(smooth[i] / (MAX_ITERATIONS + 1), 0.0f), 1.0f);
+        float s = 1.0f - t;
+        int expected[3] = {(int) lrintf(9.0f * 255 * s * t * t * t),
+                           (int) lrintf(15.0f * 255 * s * s * t * t),
+                           (int) lrintf(8.5f * 255 * s * s * s * t)};
+        for (int channel = 0; channel < 3; channel++) {
+            assert(abs(expected[channel] - rgb[3 * i + channel]) <= 1);
+        }
+    }
+    std::cout << name << ":\tPASSED" << std::endl;
+}
+
+static void checkPaletteColors(const char * name, const uint32_t * iterations, const uint32_t * palette,
+                               size_t paletteSize, const uint8_t * rgb, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t color = (iterations[i] > MAX_ITERATIONS) ? 0 : palette[iterations[i] % paletteSize];
+        assert(rgb[3 * i] == (color & 0xFF));
+        assert(rgb[3 * i + 1] == ((color >> 8) & 0xFF));
+        assert(rgb[3 * i + 2] == (color >> 16));
+    }
+    std::cout << name << ":\tPASSED" << std::endl;
+}
+
+void runHighwayColor(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgb = hwy::AllocateAligned<uint8_t>(3 * width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgbPipeline = hwy::AllocateAligned<uint8_t>(3 * width * height);
+    uint32_t palette[64];
+    createPolynomialPalette(palette, 64);
+
+    mandelbrot_highway_smooth(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &smooth[0]);
+    colorize_highway_smooth(&smooth[0], width * height, MAX_ITERATIONS + 1, &rgb[0]);
+    checkSmoothColors("colorize_highway_smooth", &smooth[0], &rgb[0], width * height);
+
+    // The bands are rendered at the pixels of the whole frame, every byte has to match
+    mandelbrot_color(mandelbrot_highway_smooth_block, -1.5f, 0.75f, -1.125f, 1.125f, width, height, &rgbPipeline[0]);
+    for (size_t i = 0; i < 3 * width * height; i++) {
+        assert(rgb[i] == rgbPipeline[i]);
+    }
+    char name[22] = "mandelbrot_color.ppm";
+    createPixmapImage(width, height, &rgbPipeline[0], name);
+    std::cout << "mandelbrot_color:\tPASSED" << std::endl;
+
+    mandelbrot_highway_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    colorize_highway_palette(&iterations[0], width * height, palette, 64, &rgb[0]);
+    checkPaletteColors("colorize_highway_palette", &iterations[0], palette, 64, &rgb[0], width * height);
+}
+#endif
+
+#ifndef SVE
+void runHighwayInteriorCheck(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageChecked = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_highway_interiorCheck(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageChecked[0]);
+
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageChecked[i]);
+    }
+    std::cout << "mandelbrot_highway_interiorCheck:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runHighwayMaxIterations(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageCapped = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageCapped[0], MAX_ITERATIONS, BAILOUT);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageCapped[i]);
+    }
+
+    // A small cap has to take effect, it keeps points in the set which escape later on
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageCapped[0], 5, BAILOUT);
+    size_t area = 0;
+    size_t cappedArea = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        assert(imageCapped[i] >= image[i]);
+        area += (image[i] == 1.0f);
+        cappedArea += (imageCapped[i] == 1.0f);
+    }
+    assert(cappedArea > area);
+
+    // A higher cap can only remove points from the set, on the specialized and the generic path
+    for (int maxIterations : {256, 257, 1000, 1001}) {
+        mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageCapped[0], maxIterations, BAILOUT);
+        for (size_t i = 0; i < width * height; i++) {
+            assert(imageCapped[i] <= image[i]);
+        }
+        std::swap(image, imageCapped);
+    }
+    std::cout << "mandelbrot_highway_maxIterations:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runHighwayPeriodicity(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imagePeriodic = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_highway_periodicity(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imagePeriodic[0]);
+
+    // Slowly escaping points close to the boarder may be taken for periodic ones
+    size_t differences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        differences += (image[i] != imagePeriodic[i]);
+    }
+    assert(differences < (width * height) / 1000);
+    std::cout << "mandelbrot_highway_periodicity:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runHighwayPacked(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> bitmap = hwy::AllocateAligned<uint8_t>(width * height / 8);
+    hwy::AlignedFreeUniquePtr<float []> unpacked = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_highway_packed(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &bitmap[0]);
+
+    // The packed bits themselves have to match the float render and the reference
+    for (size_t i = 0; i < width * height; i++) {
+        unpacked[i] = (float) ((bitmap[i / 8] >> (7 - i % 8)) & 1);
+        assert(unpacked[i] == image[i]);
+    }
+    assertMatchesReference(&unpacked[0], width, height, "mandelbrot_highway.pbm");
+
+    char name[30] = "mandelbrot_highway_packed.pbm";
+    createPackedBitmapImage(width, height, &bitmap[0], name);
+    std::cout << "mandelbrot_highway_packed:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runHighwayDouble(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> imageFloat = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<double []> imageDouble = hwy::AllocateAligned<double>(width * height);
+
+    // Both precisions agree except for a few pixels on the border of the set
+    mandelbrot_highway_precision<float>(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageFloat[0]);
+    mandelbrot_highway_precision<double>(-1.5, 0.75, -1.125, 1.125, width, height, &imageDouble[0]);
+
+    size_t differences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        differences += (imageFloat[i] != (float) imageDouble[i]);
+    }
+    assert(differences < (width * height) / 100);
+
+    // A zoom far beyond the resolution of float
+    const double xCenter = -0.743643887037151;
+    const double yCenter = 0.131825904205330;
+    const double radius = 1e-9;
+    mandelbrot_highway_precision<double>(xCenter - radius, xCenter + radius, yCenter - radius, yCenter + radius,
+                                         width, height, &imageDouble[0]);
+    for (size_t i = 0; i < width * height; i++) {
+        imageFloat[i] = (float) imageDouble[i];
+    }
+
+    char name[30] = "mandelbrot_highway_double.pbm";
+    createBitmapImage(width, height, &imageFloat[0], name);
+    std::cout << "mandelbrot_highway_double:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runHighwayPerturbation(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<double []> imageDouble = hwy::AllocateAligned<double>(width * height);
+
+    // Within the range of double both renderers have to agree
+    const double xCenter = -0.743643887037151;
+    const double yCenter = 0.131825904205330;
+    const double radius = 1e-9;
+    const double yRadius = radius * height / width;
+
+    mandelbrot_perturbation_highway(xCenter, yCenter, radius, width, height, &image[0]);
+    mandelbrot_highway_precision<double>(xCenter - radius, xCenter + radius, yCenter - yRadius, yCenter + yRadius,
+                                         width, height, &imageDouble[0]);
+
+    size_t differences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        differences += (image[i] != (float) imageDouble[i]);
+    }
+    assert(differences < (width * height) / 100);
+
+    // The pixels of the deep zoom escape after 400 to 700 iterations, with a cap of 500 the image
+    // shows the boarder of the set instead of a single color
+    mandelbrot_perturbation_highway(parseDoubleDouble("-1.76938317919551501821384728608547378290574726365475"),
+                                    parseDoubleDouble("0.00423684791873677221492650717136799707668267091740"),
+                                    1e-30, width, height, &image[0], 500, BAILOUT);
+
+    size_t interior = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        interior += (image[i] == 1.0f);
+    }
+    assert(interior > (width * height) / 2);
+    assert(interior < (width * height) * 9 / 10);
+
+    char name[36] = "mandelbrot_highway_perturbation.pbm";
+    createBitmapImage(width, height, &image[0], name);
+    std::cout << "mandelbrot_highway_perturbation:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runHighwayEscapeTime(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> reference = hwy::AllocateAligned<float>(width * height);
+
+    // The Julia set of c = 0 is the unit disk, only pixels close to the circle may differ
+    julia_highway(-2.0f, 2.0f, -2.0f, 2.0f, width, height, &image[0], 0.0f, 0.0f);
+    for (size_t j = 0; j < height; j++) {
+        for (size_t i = 0; i < width; i++) {
+            float x = -2.0f + i * (4.0f / width);
+            float y = -2.0f + j * (4.0f / height);
+            float radius = sqrtf(x * x + y * y);
+            assert(fabsf(radius - 1.0f) < 0.01f || (image[j * width + i] == 1.0f) == (radius < 1.0f));
+        }
+    }
+    std::cout << "julia_highway:\t\t\tPASSED" << std::endl;
+
+    // The multibrot set of power 2 is the mandelbrot set
+    multibrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], 2);
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &reference[0]);
+    size_t differences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        differences += (image[i] != reference[i]);
+    }
+    assert(differences < (width * height) / 1000);
+    std::cout << "multibrot_highway:\t\tPASSED" << std::endl;
+
+    burningShip_highway(-2.0f, 1.5f, -2.0f, 1.0f, width, height, &image[0]);
+    char name[32] = "burningShip_highway.pbm";
+    createBitmapImage(width, height, &image[0], name);
+    std::cout << "burningShip_highway:\t\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runComplexClass(const size_t width, const size_t height) {
+    // Masked lanes keep their value, active ones take the step
+    VecComplex<float> z(1.0f, 2.0f);
+    assert(z.mandelIterate(0.5f, 0.5f, false).norm() == 5.0f);
+    assert(z.mandelIterate(0.5f, 0.5f, true).norm() == z.mandelIterate(0.5f, 0.5f).norm());
+    assert(z.norm(false) == 0.0f && z.bounded(4.0f) == false);
+
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageComplex = hwy::AllocateAligned<float>(width * height);
+
+    /* Every generic kernel against the escape-time engine on the same backend, both take the
+     * same steps in the same order, so every pixel has to match */
+    struct {
+        MandelbrotKernel kernel;
+        const char * engine;
+    } kernels[] = {
+        {mandelbrot_complexClass_highway, "engine_highway"},
+        {mandelbrot_complexClass_libsimdpp, "engine_libsimdpp"},
+    #ifndef NEON
+        {mandelbrot_complexClass_avx2, "engine_avx2"},
+        {mandelbrot_complexClass_vc, "engine_vc"},
+    #endif	// NEON
+    };
+
+    for (auto & pair : kernels) {
+        const MandelbrotKernelInfo * engine = findMandelbrotKernel(pair.engine);
+        assert(engine != nullptr);
+        if (!isaSupported(engine->isa)) {
+            continue;
+        }
+        engine->kernel(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+        pair.kernel(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageComplex[0]);
+        for (size_t i = 0; i < width * height; i++) {
+            assert(image[i] == imageComplex[i]);
+        }
+    }
+    std::cout << "mandelbrot_complexClass:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runThreaded(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageThreaded = hwy::AllocateAligned<float>(width * height);
+
+    // The block kernel renders the tiles with the scale of the whole frame, every pixel has to match
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_threaded(mandelbrot_highway_block, -1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageThreaded[0], 4);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageThreaded[i]);
+    }
+
+    char name[24] = "mandelbrot_threaded.pbm";
+    createBitmapImage(width, height, &imageThreaded[0], name);
+    std::cout << "mandelbrot_threaded:\t\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runThreadedStreamed(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageStreamed = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageWritten = hwy::AllocateAligned<float>(width * height);
+
+    BitmapStreamWriter writer;
+    bool opened = writer.open("test/images/mandelbrot_threaded_streamed.pbm", width, height);
+    assert(opened);
+
+    mandelbrot_threaded_streamed(mandelbrot_highway_block, -1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageStreamed[0], 4,
+                                 BitmapStreamWriter::rowsCallback, &writer);
+
+    bool complete = writer.close();
+    assert(complete);
+    (void) opened;
+    (void) complete;
+
+    // Every band has to reach the file once and in order, so the file holds the single threaded image
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    bool read = readBitmapImage(width, height, &imageWritten[0], "mandelbrot_threaded_streamed.pbm");
+    assert(read);
+    (void) read;
+    for (size_t i = 0; i < width * height; i++) {
+        assert(imageStreamed[i] == image[i]);
+        assert(imageWritten[i] == image[i]);
+    }
+    std::cout << "mandelbrot_threaded_streamed:\tPASSED" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runSubdivision(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> imageSubdivided = hwy::AllocateAligned<float>(width * height);
+
+    // The boarders are rendered at the pixels of the whole frame, only filaments thinner than a pixel
+    // inside a uniform boarder may be missed
+    size_t iterated = mandelbrot_subdivision(mandelbrot_highway_block, -1.5f, 0.75f, -1.125f, 1.125f,
+                                             width, height, &imageSubdivided[0]);
+    assertMatchesReference(&imageSubdivided[0], width, height, "mandelbrot_highway.pbm");
+    assert(iterated < width * height);
+
+    #ifndef NEON
+    iterated = mandelbrot_subdivision(mandelbrot_avx2_block, -1.5f, 0.75f, -1.125f, 1.125f,
+                                      width, height, &imageSubdivided[0]);
+    assertMatchesReference(&imageSubdivided[0], width, height, "mandelbrot_AVX2.pbm");
+    assert(iterated < width * height);
+    #endif	// NEON
+
+    char name[26] = "mandelbrot_subdivided.pbm";
+    createBitmapImage(width, height, &imageSubdivided[0], name);
+    std::cout << "mandelbrot_subdivision:\t\tPASSED (" << iterated << " of " << width * height << " pixels iterated)" << std::endl;
+}
+#endif
+
+#ifndef SVE
+void runDispatch(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageDispatched = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_highway_dispatch(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageDispatched[0]);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageDispatched[i]);
+    }
+
+    // The dispatched kernel has to honour a runtime cap as well
+    mandelbrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], 5, BAILOUT);
+    mandelbrot_highway_dispatch(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageDispatched[0], 5, BAILOUT);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageDispatched[i]);
+    }
+    std::cout << "mandelbrot_highway_dispatch:\tPASSED (" << mandelbrot_highway_dispatch_target() << ")" << std::endl;
+
+    #ifndef NEON
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_intrinsics_dispatch(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageDispatched[0]);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageDispatched[i]);
+    }
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], 5, BAILOUT);
+    mandelbrot_intrinsics_dispatch(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageDispatched[0], 5, BAILOUT);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageDispatched[i]);
+    }
+    std::cout << "mandelbrot_intrinsics_dispatch:\tPASSED (" << mandelbrot_intrinsics_dispatch_target() << ")" << std::endl;
+    #endif	// NEON
+}
+#endif
+
+#ifndef SVE
+void runRegistry(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> imageRegistered = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> referenceHighway = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> referenceAVX2 = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageThreaded = hwy::AllocateAligned<float>(width * height);
+    bool read = readBitmapImage(width, height, &referenceHighway[0], "mandelbrot_highway.pbm")
+             && readBitmapImage(width, height, &referenceAVX2[0], "mandelbrot_AVX2.pbm");
+    assert(read);
+    (void) read;
+
+    /* The kernels place the first column at xBegin like mandelbrot_highway or one pixel further
+     * like mandelbrot_avx2. A shifted column flips far more pixels than the rounding does, so every
+     * kernel has to match one of the two references pixel by pixel. */
+    for (const MandelbrotKernelInfo & info : mandelbrotKernels()) {
+        if (!isaSupported(info.isa) || width % info.widthMultiple != 0) {
+            continue;
+        }
+        for (MandelbrotKernel kernel : {info.kernel, info.interiorCheckKernel}) {
+            if (kernel == nullptr) {
+                continue;
+            }
+            kernel(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageRegistered[0]);
+            size_t differences = std::min(countDifferences(&imageRegistered[0], &referenceHighway[0], width, height),
+                                          countDifferences(&imageRegistered[0], &referenceAVX2[0], width, height));
+            assert(differences <= (width * height) / 5000);
+        }
+        // The threaded render of mandelRender uses the block kernel, its tiles share the scale of the frame
+        if (info.blockKernel != nullptr) {
+            info.kernel(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageRegistered[0]);
+            mandelbrot_threaded(info.blockKernel, -1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageThreaded[0], 4);
+            assert(countDifferences(&imageThreaded[0], &imageRegistered[0], width, height) == 0);
+        }
+        std::cout << "registry " << info.name << ":\tPASSED" << std::endl;
+    }
+}
+#endif
+
+#ifndef SVE
+void runStats(const size_t width, const size_t height) {
+    if (!mandelbrotStatsEnabled()) {
+        std::cout << "mandelbrot stats:\tSKIPPED (built without MANDELBROT_STATS)" << std::endl;
+        return;
+    }
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    mandelbrot_highway_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    uint64_t total = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        total += iterations[i];
+    }
+
+    // The useful lane iterations are the iteration counts, the kernels only differ in rounding
+    std::pair<const char *, MandelbrotKernel> kernels[] = {
+        {"mandelbrot_highway", mandelbrot_highway},
+        {"mandelbrot_highway_refill", mandelbrot_highway_refill},
+    #ifndef NEON
+        {"mandelbrot_avx2", mandelbrot_avx2},
+        {"mandelbrot_avx2_refill", mandelbrot_avx2_refill},
+    #endif	// NEON
+    };
+    for (auto & kernel : kernels) {
+        resetMandelbrotStats();
+        kernel.second(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+        MandelbrotStats stats = getMandelbrotStats();
+
+        assert(stats.usefulLaneIterations <= stats.laneIterations);
+        assert(std::max(total, stats.usefulLaneIterations) - std::min(total, stats.usefulLaneIterations) < total / 100);
+        std::cout << kernel.first << " stats:\tPASSED (" << 100 * stats.laneUtilization() << "% lane utilization)" << std::endl;
+    }
+}
+#endif
+
 #ifndef SVE
 #ifndef NEON
 void runVc(const size_t width, const size_t height) {
@@ -58,14 +660,293 @@ void runVc(const size_t width, const size_t height) {
 #ifndef SVE
 #ifndef NEON
 void runAVX2(const size_t width, const size_t height) {
-    __attribute__((aligned(32))) float image[width * height];
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
 
-    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, image); 
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
 
-    char name[20] = "mandelbrot_AVX2.pbm";
-    createBitmapImage(width, height, image, name);
+    // The reference stays untouched, the render is written next to it
+    assertMatchesReference(&image[0], width, height, "mandelbrot_AVX2.pbm");
+    char name[24] = "mandelbrot_AVX2_out.pbm";
+    createBitmapImage(width, height, &image[0], name);
     std::cout << name <<":\t\tCOMPLETED" << std::endl;
 }
+
+void runAVX2Iterations(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_avx2_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+
+    for (size_t i = 0; i < width * height; i++) {
+        assert((image[i] == 1.0f) == (iterations[i] == MAX_ITERATIONS + 1));
+    }
+    std::cout << "mandelbrot_avx2_iterations:\tPASSED" << std::endl;
+}
+
+/* The other libraries compute the same orbit, only c_real is rounded differently where they multiply
+ * and add instead of fusing, which changes the count of about 0.25% of the pixels. Vc and pure_simd
+ * place the first column at xBegin, their column i is column i - 1 of mandelbrot_avx2. A column
+ * shifted by mistake changes the counts of more than 7% of the pixels. */
+static void assertIterationsMatchAVX2(const char * name, const uint32_t * iterations, const uint32_t * reference,
+                                      const size_t width, const size_t height, const size_t shift) {
+    size_t differences = 0;
+    for (size_t j = 0; j < height; j++) {
+        for (size_t i = shift; i < width; i++) {
+            differences += (iterations[(j * width) + i] != reference[(j * width) + i - shift]);
+        }
+    }
+    assert(differences <= (width * height) / 100);
+    std::cout << name << ":\tPASSED" << std::endl;
+}
+
+void runIterationsAgainstAVX2(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<uint32_t []> reference = hwy::AllocateAligned<uint32_t>(width * height);
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+
+    mandelbrot_avx2_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &reference[0]);
+
+    mandelbrot_vc_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    assertIterationsMatchAVX2("mandelbrot_vc_iterations", &iterations[0], &reference[0], width, height, 1);
+
+    mandelbrot_libsimdpp_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    assertIterationsMatchAVX2("mandelbrot_libsimdpp_iterations", &iterations[0], &reference[0], width, height, 0);
+
+    mandelbrot_pure_simd_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    assertIterationsMatchAVX2("mandelbrot_pure_simd_iterations", &iterations[0], &reference[0], width, height, 1);
+
+    #ifdef AVX512
+    mandelbrot_avx512_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    assertIterationsMatchAVX2("mandelbrot_avx512_iterations", &iterations[0], &reference[0], width, height, 0);
+    #endif  // AVX512
+
+    mandelbrot_nsimd_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    assertIterationsMatchAVX2("mandelbrot_nsimd_iterations", &iterations[0], &reference[0], width, height, 0);
+
+    mandelbrot_nsimdBase_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    assertIterationsMatchAVX2("mandelbrot_nsimdBase_iterations", &iterations[0], &reference[0], width, height, 0);
+
+    mandelbrot_simde_avx2_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    assertIterationsMatchAVX2("mandelbrot_simde_avx2_iterations", &iterations[0], &reference[0], width, height, 0);
+}
+
+void runAVX2Smooth(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_avx2_smooth(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &smooth[0]);
+    checkSmooth("mandelbrot_avx2_smooth", &smooth[0], width, height, 1.0f);
+}
+
+void runAVX2Color(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> smooth = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint32_t []> iterations = hwy::AllocateAligned<uint32_t>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> rgb = hwy::AllocateAligned<uint8_t>(3 * width * height);
+    uint32_t palette[64];
+    createPolynomialPalette(palette, 64);
+
+    mandelbrot_avx2_smooth(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &smooth[0]);
+    colorize_avx2_smooth(&smooth[0], width * height, MAX_ITERATIONS + 1, &rgb[0]);
+    checkSmoothColors("colorize_avx2_smooth", &smooth[0], &rgb[0], width * height);
+
+    mandelbrot_avx2_iterations(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &iterations[0]);
+    colorize_avx2_palette(&iterations[0], width * height, palette, 64, &rgb[0]);
+    checkPaletteColors("colorize_avx2_palette", &iterations[0], palette, 64, &rgb[0], width * height);
+}
+
+void runAVX2InteriorCheck(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageChecked = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_avx2_interiorCheck(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageChecked[0]);
+
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageChecked[i]);
+    }
+    std::cout << "mandelbrot_avx2_interiorCheck:\tPASSED" << std::endl;
+}
+
+void runAVX2Interleaved(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageInterleaved = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+
+    for (int interleave : {1, 2, 4}) {
+        mandelbrot_avx2_interleaved(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageInterleaved[0], interleave);
+        for (size_t i = 0; i < width * height; i++) {
+            assert(image[i] == imageInterleaved[i]);
+        }
+    }
+
+    for (int maxIterations : {5, 1001}) {
+        mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], maxIterations, BAILOUT);
+        mandelbrot_avx2_interleaved(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageInterleaved[0], 4,
+                                    maxIterations, BAILOUT);
+        for (size_t i = 0; i < width * height; i++) {
+            assert(image[i] == imageInterleaved[i]);
+        }
+    }
+    std::cout << "mandelbrot_avx2_interleaved:\tPASSED" << std::endl;
+}
+
+void runAVX2MaxIterations(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageCapped = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageCapped[0], MAX_ITERATIONS, BAILOUT);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageCapped[i]);
+    }
+
+    // A small cap has to take effect, it keeps points in the set which escape later on
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageCapped[0], 5, BAILOUT);
+    size_t area = 0;
+    size_t cappedArea = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        assert(imageCapped[i] >= image[i]);
+        area += (image[i] == 1.0f);
+        cappedArea += (imageCapped[i] == 1.0f);
+    }
+    assert(cappedArea > area);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], 1000, BAILOUT);
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageCapped[0], 1001, BAILOUT);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(imageCapped[i] <= image[i]);
+    }
+    std::cout << "mandelbrot_avx2_maxIterations:\tPASSED" << std::endl;
+}
+
+void runAVX2Periodicity(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imagePeriodic = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_avx2_periodicity(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imagePeriodic[0]);
+
+    size_t differences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        differences += (image[i] != imagePeriodic[i]);
+    }
+    assert(differences < (width * height) / 1000);
+    std::cout << "mandelbrot_avx2_periodicity:\tPASSED" << std::endl;
+}
+
+void runAVX2Packed(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<uint8_t []> bitmap = hwy::AllocateAligned<uint8_t>(width * height / 8);
+    hwy::AlignedFreeUniquePtr<float []> unpacked = hwy::AllocateAligned<float>(width * height);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_avx2_packed(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &bitmap[0]);
+
+    // The packed bits themselves have to match the float render and the reference
+    for (size_t i = 0; i < width * height; i++) {
+        unpacked[i] = (float) ((bitmap[i / 8] >> (7 - i % 8)) & 1);
+        assert(unpacked[i] == image[i]);
+    }
+    assertMatchesReference(&unpacked[0], width, height, "mandelbrot_AVX2.pbm");
+
+    char name[27] = "mandelbrot_AVX2_packed.pbm";
+    createPackedBitmapImage(width, height, &bitmap[0], name);
+    std::cout << "mandelbrot_avx2_packed:\t\tPASSED" << std::endl;
+}
+
+void runAVX2Double(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> imageFloat = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<double []> imageDouble = hwy::AllocateAligned<double>(width * height);
+
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageFloat[0]);
+    mandelbrot_avx2_double(-1.5, 0.75, -1.125, 1.125, width, height, &imageDouble[0]);
+
+    size_t differences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        differences += (imageFloat[i] != (float) imageDouble[i]);
+    }
+    assert(differences < (width * height) / 100);
+    std::cout << "mandelbrot_avx2_double:\t\tPASSED" << std::endl;
+}
+
+void runAVX2EscapeTime(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageHighway = hwy::AllocateAligned<float>(width * height);
+
+    // Both backends run the same formulas, the chaotic boarder of the burning ship may round differently
+    julia_avx2(-1.5f, 1.5f, -1.5f, 1.5f, width, height, &image[0], -0.123f, 0.745f);
+    julia_highway(-1.5f, 1.5f, -1.5f, 1.5f, width, height, &imageHighway[0], -0.123f, 0.745f);
+    size_t juliaDifferences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        juliaDifferences += (image[i] != imageHighway[i]);
+    }
+    assert(juliaDifferences < (width * height) / 1000);
+    std::cout << "julia_avx2:\t\t\tPASSED" << std::endl;
+
+    burningShip_avx2(-2.0f, 1.5f, -2.0f, 1.0f, width, height, &image[0]);
+    burningShip_highway(-2.0f, 1.5f, -2.0f, 1.0f, width, height, &imageHighway[0]);
+    size_t shipDifferences = 0;
+    for (size_t i = 0; i < width * height; i++) {
+        shipDifferences += (image[i] != imageHighway[i]);
+    }
+    assert(shipDifferences < (width * height) / 50);
+    std::cout << "burningShip_avx2:\t\tPASSED" << std::endl;
+
+    for (int power = 2; power <= 8; power++) {
+        multibrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], power);
+        multibrot_highway(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageHighway[0], power);
+        size_t differences = 0;
+        for (size_t i = 0; i < width * height; i++) {
+            differences += (image[i] != imageHighway[i]);
+        }
+        assert(differences < (width * height) / 1000);
+    }
+    std::cout << "multibrot_avx2:\t\t\tPASSED" << std::endl;
+}
+
+void runAVX2Perturbation(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageHighway = hwy::AllocateAligned<float>(width * height);
+
+    // Both backends iterate the same deltas in double precision, lane by lane
+    DoubleDouble xCenter = parseDoubleDouble("-1.76938317919551501821384728608547378290574726365475");
+    DoubleDouble yCenter = parseDoubleDouble("0.00423684791873677221492650717136799707668267091740");
+    mandelbrot_perturbation_avx2(xCenter, yCenter, 1e-30, width, height, &image[0], 500, BAILOUT);
+    mandelbrot_perturbation_highway(xCenter, yCenter, 1e-30, width, height, &imageHighway[0], 500, BAILOUT);
+    assert(countDifferences(&image[0], &imageHighway[0], width, height) <= (width * height) / 5000);
+
+    mandelbrot_perturbation_avx2(-0.743643887037151, 0.131825904205330, 1e-9, width, height, &image[0], 2000, BAILOUT);
+    mandelbrot_perturbation_highway(-0.743643887037151, 0.131825904205330, 1e-9, width, height, &imageHighway[0], 2000, BAILOUT);
+    assert(countDifferences(&image[0], &imageHighway[0], width, height) <= (width * height) / 5000);
+
+    char name[33] = "mandelbrot_AVX2_perturbation.pbm";
+    createBitmapImage(width, height, &image[0], name);
+    std::cout << "mandelbrot_perturbation_avx2:	PASSED" << std::endl;
+}
+
+void runAVX2Refill(const size_t width, const size_t height) {
+    hwy::AlignedFreeUniquePtr<float []> image = hwy::AllocateAligned<float>(width * height);
+    hwy::AlignedFreeUniquePtr<float []> imageRefill = hwy::AllocateAligned<float>(width * height);
+
+    // Refilled lanes compute the same pixels, only in a different order
+    mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0]);
+    mandelbrot_avx2_refill(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageRefill[0]);
+    for (size_t i = 0; i < width * height; i++) {
+        assert(image[i] == imageRefill[i]);
+    }
+
+    for (int maxIterations : {5, 1001}) {
+        mandelbrot_avx2(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &image[0], maxIterations, BAILOUT);
+        mandelbrot_avx2_refill(-1.5f, 0.75f, -1.125f, 1.125f, width, height, &imageRefill[0], maxIterations, BAILOUT);
+        for (size_t i = 0; i < width * height; i++) {
+            assert(image[i] == imageRefill[i]);
+        }
+    }
+
+    char name[27] = "mandelbrot_AVX2_refill.pbm";
+    createBitmapImage(width, height, &imageRefill[0], name);
+    std::cout << "mandelbrot_avx2_refill:\t\tPASSED" << std::endl;
+}
 #endif	// NEON
 #endif 	// SVE
 
@@ -183,9 +1064,70 @@ int main() {
 	runHighway(width, height);
 	#endif
 
+	#ifndef SVE
+	runHighwayRefill(width, height);
+	#endif
+
+	#ifndef SVE
+	runHighwayIterations(width, height);
+	runHighwaySmooth(width, height);
+	runHighwayColor(width, height);
+	#endif
+
+	#ifndef SVE
+	runHighwayInteriorCheck(width, height);
+	#endif
+
+	#ifndef SVE
+	runHighwayMaxIterations(width, height);
+	#endif
+
+	#ifndef SVE
+	runHighwayPeriodicity(width, height);
+	#endif
+
+	#ifndef SVE
+	runHighwayPacked(width, height);
+	#endif
+
+	#ifndef SVE
+	runHighwayDouble(width, height);
+	#endif
+
+	#ifndef SVE
+	runHighwayPerturbation(width, height);
+	runHighwayEscapeTime(width, height);
+	#endif
+
+	#ifndef SVE
+	runThreaded(width, height);
+	runThreadedStreamed(width, height);
+	#endif
+
+	#ifndef SVE
+	runSubdivision(width, height);
+	runDispatch(width, height);
+	runRegistry(width, height);
+	runComplexClass(width, height);
+	runStats(width, height);
+	#endif
+
 	#ifndef SVE
 	#ifndef NEON
 	runAVX2(width, height);
+	runAVX2Refill(width, height);
+	runAVX2Iterations(width, height);
+	runIterationsAgainstAVX2(width, height);
+	runAVX2Smooth(width, height);
+	runAVX2Color(width, height);
+	runAVX2InteriorCheck(width, height);
+	runAVX2Interleaved(width, height);
+	runAVX2MaxIterations(width, height);
+	runAVX2Periodicity(width, height);
+	runAVX2Packed(width, height);
+	runAVX2Double(width, height);
+	runAVX2EscapeTime(width, height);
+	runAVX2Perturbation(width, height);
 	#endif	// NEON
 	#endif 	// SVE
     	
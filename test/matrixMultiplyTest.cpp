@@ -0,0 +1,47 @@
+#include <iostream>
+#include <assert.h>
+#include <vector>
+
+#include "../matrixMultiply/matrixMultiply.hpp"
+
+/* Shapes around the tile size and beyond SGEMM_MC, SGEMM_KC and SGEMM_NC, including empty ones.
+ * The small integers keep every sum exact, so the blocked versions have to equal the triple loop
+ * for every thread count. */
+void sgemm_test(SgemmKernel kernel, const char * name) {
+    const size_t shapes[][3] = {{1, 1, 1}, {6, 16, 1}, {7, 17, 3}, {5, 15, 0}, {0, 8, 4},
+                                {96, 64, 256}, {97, 33, 257}, {200, 300, 100}, {13, 4100, 9}};
+
+    for (const auto & shape : shapes) {
+        size_t m = shape[0];
+        size_t n = shape[1];
+        size_t k = shape[2];
+
+        std::vector<float> a(m * k);
+        std::vector<float> b(k * n);
+        for (size_t i = 0; i < a.size(); i++) {
+            a[i] = (float) (i % 5);
+        }
+        for (size_t i = 0; i < b.size(); i++) {
+            b[i] = (float) (i % 3);
+        }
+
+        std::vector<float> expected(m * n);
+        sgemm_naive(a.data(), b.data(), expected.data(), m, n, k);
+
+        for (size_t threads = 1; threads <= 4; threads++) {
+            std::vector<float> c(m * n, -1.0f);
+            kernel(a.data(), b.data(), c.data(), m, n, k, threads);
+            assert(c == expected);
+        }
+    }
+    std::cout << name << " \tPASSED" << std::endl;
+}
+
+
+int main () {
+    sgemm_test(sgemm_avx2, "sgemm_avx2");
+    sgemm_test(sgemm_highway, "sgemm_highway");
+    sgemm_test(sgemm_vc, "sgemm_vc");
+    sgemm_test(sgemm_libsimdpp, "sgemm_libsimdpp");
+    sgemm_test(sgemm_pure_simd, "sgemm_pure_simd");
+}
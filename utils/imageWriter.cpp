@@ -0,0 +1,183 @@
+#include <assert.h>
+#include <stdio.h>
+#include <vector>
+
+#include "imageWriter.hpp"
+
+// P4 rows are padded to full bytes
+static size_t packedRowBytes(size_t width) {
+    return (width + 7) / 8;
+}
+
+static void packRows(const float * rows, size_t width, size_t rowCount, uint8_t * out) {
+    size_t rowBytes = packedRowBytes(width);
+
+    for (size_t j = 0; j < rowCount; j++) {
+        const float * row = &rows[j * width];
+        uint8_t * packed = &out[j * rowBytes];
+
+        for (size_t k = 0; k < rowBytes; k++) {
+            size_t pixels = (width - k * 8 < 8) ? width - k * 8 : 8;
+            uint8_t bits = 0;
+            for (size_t b = 0; b < pixels; b++) {
+                bits |= (uint8_t) (row[k * 8 + b] != 0.0f) << (7 - b);
+            }
+            packed[k] = bits;
+        }
+    }
+}
+
+static FILE * createImageFile(const char * path, const char * magic, size_t width, size_t height) {
+    FILE * f = fopen(path, "wb");
+
+    if (f && fprintf(f, "%s\n%zu %zu\n", magic, width, height) < 0) {
+        fclose(f);
+        return NULL;
+    }
+    return f;
+}
+
+static bool writeAndClose(FILE * f, const void * data, size_t bytes) {
+    bool written = fwrite(data, 1, bytes, f) == bytes;
+    return (fclose(f) == 0) && written;
+}
+
+
+bool writeBitmapImage(const char * path, size_t width, size_t height, const float * image) {
+    FILE * f = createImageFile(path, "P4", width, height);
+    if (!f) {
+        return false;
+    }
+
+    std::vector<uint8_t> bitmap(packedRowBytes(width) * height);
+    packRows(image, width, height, bitmap.data());
+
+    return writeAndClose(f, bitmap.data(), bitmap.size());
+}
+
+
+bool writePlainBitmapImage(const char * path, size_t width, size_t height, const float * image) {
+    FILE * f = createImageFile(path, "P1", width, height);
+    if (!f) {
+        return false;
+    }
+
+    // " 0" or " 1" per pixel and a line break per row
+    std::vector<char> text((2 * width + 1) * height);
+    char * out = text.data();
+    for (size_t j = 0; j < height; j++) {
+        for (size_t i = 0; i < width; i++) {
+            *out++ = ' ';
+            *out++ = (image[j * width + i] != 0.0f) ? '1' : '0';
+        }
+        *out++ = '\n';
+    }
+
+    return writeAndClose(f, text.data(), text.size());
+}
+
+
+bool writePackedBitmapImage(const char * path, size_t width, size_t height, const uint8_t * bitmap) {
+    assert(width % 8 == 0);
+
+    FILE * f = createImageFile(path, "P4", width, height);
+    if (!f) {
+        return false;
+    }
+
+    return writeAndClose(f, bitmap, (width / 8) * height);
+}
+
+
+bool writeGraymapImage(const char * path, size_t width, size_t height,
+                       const uint32_t * counts, uint32_t maxValue) {
+    assert(maxValue > 0 && maxValue <= 65535);
+
+    FILE * f = createImageFile(path, "P5", width, height);
+    if (!f || fprintf(f, "%u\n", maxValue) < 0) {
+        if (f) {
+            fclose(f);
+        }
+        return false;
+    }
+
+    // Samples wider than a byte are stored big endian
+    size_t sampleBytes = (maxValue < 256) ? 1 : 2;
+    std::vector<uint8_t> graymap(width * height * sampleBytes);
+
+    for (size_t k = 0; k < width * height; k++) {
+        uint32_t value = (counts[k] < maxValue) ? counts[k] : maxValue;
+        if (sampleBytes == 1) {
+            graymap[k] = (uint8_t) value;
+        } else {
+            graymap[2 * k] = (uint8_t) (value >> 8);
+            graymap[2 * k + 1] = (uint8_t) value;
+        }
+    }
+
+    return writeAndClose(f, graymap.data(), graymap.size());
+}
+
+
+bool writePixmapImage(const char * path, size_t width, size_t height, const uint8_t * rgb) {
+    FILE * f = createImageFile(path, "P6", width, height);
+    if (!f || fprintf(f, "255\n") < 0) {
+        if (f) {
+            fclose(f);
+        }
+        return false;
+    }
+
+    return writeAndClose(f, rgb, 3 * width * height);
+}
+
+
+BitmapStreamWriter::BitmapStreamWriter()
+    : file(NULL), width(0), height(0), rowsWritten(0), failed(false) {}
+
+BitmapStreamWriter::~BitmapStreamWriter() {
+    close();
+}
+
+bool BitmapStreamWriter::open(const char * path, size_t width, size_t height) {
+    close();
+
+    this->width = width;
+    this->height = height;
+    rowsWritten = 0;
+    failed = false;
+
+    file = createImageFile(path, "P4", width, height);
+    return file != NULL;
+}
+
+void BitmapStreamWriter::writeRows(const float * rows, size_t rowCount) {
+    assert(rowsWritten + rowCount <= height);
+    if (!file || failed) {
+        rowsWritten += rowCount;
+        return;
+    }
+
+    buffer.resize(packedRowBytes(width) * rowCount);
+    packRows(rows, width, rowCount, buffer.data());
+
+    failed = fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size();
+    rowsWritten += rowCount;
+}
+
+bool BitmapStreamWriter::close() {
+    if (!file) {
+        return false;
+    }
+
+    bool complete = (fclose(file) == 0) && !failed && rowsWritten == height;
+    file = NULL;
+    return complete;
+}
+
+void BitmapStreamWriter::rowsCallback(const float * rows, size_t firstRow, size_t rowCount, void * userData) {
+    BitmapStreamWriter * writer = static_cast<BitmapStreamWriter *>(userData);
+    assert(firstRow == writer->rowsWritten);
+    (void) firstRow;
+    writer->writeRows(rows, rowCount);
+}
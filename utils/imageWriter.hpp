@@ -0,0 +1,142 @@
+#ifndef imageWriter
+#define imageWriter
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/**
+ * Writes a binary Bitmap image (P4) of a float array. Every pixel which is not zero is set.
+ *
+ * @param path
+ *          The path of the file (.pbm)
+ * @param width
+ *          The width of the image
+ * @param height
+ *          The height of the image
+ * @param image
+ *          The array for the image
+ *
+ * @return  Whether the file was written completely
+*/
+bool writeBitmapImage(const char * path, size_t width, size_t height, const float * image);
+
+/**
+ * Writes a plain Bitmap image (P1) of a float array, the format of the reference images
+ * in test/images/. Every pixel which is not zero is set.
+ *
+ * @param path
+ *          The path of the file (.pbm)
+ * @param width
+ *          The width of the image
+ * @param height
+ *          The height of the image
+ * @param image
+ *          The array for the image
+ *
+ * @return  Whether the file was written completely
+*/
+bool writePlainBitmapImage(const char * path, size_t width, size_t height, const float * image);
+
+/**
+ * Writes a binary Bitmap image (P4) of a bit-packed image with one bit per pixel,
+ * most significant bit first.
+ *
+ * @param path
+ *          The path of the file (.pbm)
+ * @param width
+ *          The width of the image, must be a multiple of 8
+ * @param height
+ *          The height of the image
+ * @param bitmap
+ *          The packed image with width * height / 8 bytes
+ *
+ * @return  Whether the file was written completely
+*/
+bool writePackedBitmapImage(const char * path, size_t width, size_t height, const uint8_t * bitmap);
+
+/**
+ * Writes a binary Graymap image (P5) of per pixel iteration counts. Counts above maxValue
+ * are clamped, values are stored with 16 bits if maxValue does not fit into a byte.
+ *
+ * @param path
+ *          The path of the file (.pgm)
+ * @param width
+ *          The width of the image
+ * @param height
+ *          The height of the image
+ * @param counts
+ *          The iteration count of every pixel
+ * @param maxValue
+ *          The count mapped to white, at most 65535
+ *
+ * @return  Whether the file was written completely
+*/
+bool writeGraymapImage(const char * path, size_t width, size_t height,
+                       const uint32_t * counts, uint32_t maxValue);
+
+/**
+ * Writes a binary Pixmap image (P6) of interleaved 8 bit RGB pixels.
+ *
+ * @param path
+ *          The path of the file (.ppm)
+ * @param width
+ *          The width of the image
+ * @param height
+ *          The height of the image
+ * @param rgb
+ *          The red, green and blue value of every pixel, 3 * width * height bytes
+ *
+ * @return  Whether the file was written completely
+*/
+bool writePixmapImage(const char * path, size_t width, size_t height, const uint8_t * rgb);
+
+/**
+ * Streams a binary Bitmap image (P4) to a file while it is being rendered.
+ * Rows have to be handed over in order, they are packed and written in one call per batch.
+*/
+class BitmapStreamWriter {
+    public:
+        BitmapStreamWriter();
+        ~BitmapStreamWriter();
+
+        /**
+         * Creates the file and writes the header.
+         *
+         * @return  Whether the file could be created
+        */
+        bool open(const char * path, size_t width, size_t height);
+
+        /**
+         * Packs and writes the next rows of the image.
+         *
+         * @param rows
+         *          The first pixel of the rows, rows are width pixels apart
+         * @param rowCount
+         *          The number of rows
+        */
+        void writeRows(const float * rows, size_t rowCount);
+
+        /**
+         * Closes the file.
+         *
+         * @return  Whether every row of the image was written
+        */
+        bool close();
+
+        /**
+         * Adapter for the row callback of mandelbrot_threaded_streamed, userData is the writer.
+        */
+        static void rowsCallback(const float * rows, size_t firstRow, size_t rowCount, void * userData);
+
+    private:
+        FILE * file;
+        size_t width;
+        size_t height;
+        size_t rowsWritten;
+        bool failed;
+        std::vector<uint8_t> buffer;
+};
+
+#endif  // imageWriter
@@ -4,8 +4,11 @@
 #include <ctime>
 #include <fstream> 
 #include <cstring>
+#include <string>
+#include <sys/mman.h>
 
 #include "utils.hpp"
+#include "imageWriter.hpp"
 
 using std::chrono::duration;
 using namespace std;
@@ -49,20 +52,75 @@ void fillFloatArrayRandom(float * array, int length) {
     }
 }
 
+float * allocateHugePageArray(size_t length) {
+    const size_t hugePageSize = 2 * 1024 * 1024;
+    // aligned_alloc needs a multiple of the alignment
+    size_t bytes = (length * sizeof(float) + hugePageSize - 1) / hugePageSize * hugePageSize;
+    float * array = (float *) aligned_alloc(hugePageSize, bytes);
+#ifdef MADV_HUGEPAGE
+    if (array != nullptr) {
+        madvise(array, bytes, MADV_HUGEPAGE);
+    }
+#endif
+    return array;
+}
+
 void createBitmapImage(size_t width, size_t height, float * image, char * name) {
+    std::string path = std::string("test/images/") + name;
+    writePlainBitmapImage(path.c_str(), width, height, image);
+}
 
-    char path[64] = "test/images/";
-    FILE * f = fopen(strcat(path, name), "w+");
+void createBinaryBitmapImage(size_t width, size_t height, float * image, char * name) {
+    std::string path = std::string("test/images/") + name;
+    writeBitmapImage(path.c_str(), width, height, image);
+}
 
-    if (f){
-        fprintf(f, "P1\n");
-        fprintf(f, "%ld %ld\n", width, height);
+bool readBitmapImage(size_t width, size_t height, float * image, const char * name) {
+    std::string path = std::string("test/images/") + name;
+    ifstream file(path, ios::binary);
 
+    std::string magic;
+    size_t fileWidth = 0;
+    size_t fileHeight = 0;
+    if (!(file >> magic >> fileWidth >> fileHeight) || fileWidth != width || fileHeight != height) {
+        return false;
+    }
+
+    if (magic == "P1") {
+        for (size_t i = 0; i < width * height; i++) {
+            int pixel;
+            if (!(file >> pixel)) {
+                return false;
+            }
+            image[i] = (pixel != 0) ? 1.0f : 0.0f;
+        }
+        return true;
+    }
+
+    if (magic == "P4") {
+        // A single whitespace separates the header from the rows, which are padded to full bytes
+        file.get();
+        size_t rowBytes = (width + 7) / 8;
+        std::string row(rowBytes, '\0');
         for (size_t j = 0; j < height; j++) {
+            if (!file.read(&row[0], rowBytes)) {
+                return false;
+            }
             for (size_t i = 0; i < width; i++) {
-                fprintf(f, " %d", (int) image[j * width + i]);
+                image[j * width + i] = ((row[i / 8] >> (7 - i % 8)) & 1) ? 1.0f : 0.0f;
             }
-            fprintf(f, "\n");
         }
+        return true;
     }
-}
\ No newline at end of file
+    return false;
+}
+
+void createPackedBitmapImage(size_t width, size_t height, const uint8_t * bitmap, char * name) {
+    std::string path = std::string("test/images/") + name;
+    writePackedBitmapImage(path.c_str(), width, height, bitmap);
+}
+
+void createPixmapImage(size_t width, size_t height, const uint8_t * rgb, char * name) {
+    std::string path = std::string("test/images/") + name;
+    writePixmapImage(path.c_str(), width, height, rgb);
+}
@@ -2,6 +2,7 @@
 #define utils
 
 #include <chrono> 
+#include <cstdint>
 #include <iostream>
 
 using std::chrono::duration;
@@ -54,7 +55,19 @@ duration<double, std::milli> getAverageTime(duration<double, std::milli> * times
 void fillFloatArrayRandom(float * array, int length);
 
 /**
- * Creates a Bitmap image of a float array. 
+ * Allocates a float array aligned to 2 MiB and asks the kernel to back it with transparent 
+ * huge pages, which saves TLB misses on large images. The array is released with free.
+ *
+ * @param length
+ *          The length of the array
+ *
+ * @return  The array, nullptr if it could not be allocated
+*/
+float * allocateHugePageArray(size_t length);
+
+/**
+ * Creates a plain Bitmap image (P1) of a float array in test/images/, the format of the
+ * reference images there.
  *
  * @param width
  *          The width of the image
@@ -67,6 +80,66 @@ void fillFloatArrayRandom(float * array, int length);
 */
 void createBitmapImage(size_t width, size_t height, float * image,  char * name);
 
+/**
+ * Creates a binary Bitmap image (P4) of a float array in test/images/.
+ *
+ * @param width
+ *          The width of the image
+ * @param height
+ *          The height of the image
+ * @param image
+ *          The array for the image
+ * @param name
+ *          The file name with extension (.pbm)
+*/
+void createBinaryBitmapImage(size_t width, size_t height, float * image,  char * name);
+
+/**
+ * Reads a plain (P1) or binary (P4) Bitmap image from test/images/ into a float array,
+ * set pixels become 1 and the others 0.
+ *
+ * @param width
+ *          The expected width of the image
+ * @param height
+ *          The expected height of the image
+ * @param image
+ *          The array for the image
+ * @param name
+ *          The file name with extension (.pbm)
+ *
+ * @return  Whether an image of the expected dimensions was read completely
+*/
+bool readBitmapImage(size_t width, size_t height, float * image, const char * name);
+
+/**
+ * Creates a binary Bitmap image (P4) of a bit-packed image with one bit per pixel,
+ * most significant bit first, in test/images/.
+ *
+ * @param width
+ *          The width of the image, must be a multiple of 8
+ * @param height
+ *          The height of the image
+ * @param bitmap
+ *          The packed image with width * height / 8 bytes
+ * @param name
+ *          The file name with extension (.pbm)
+*/
+void createPackedBitmapImage(size_t width, size_t height, const uint8_t * bitmap, char * name);
+
+/**
+ * Creates a binary Pixmap image (P6) of interleaved 8 bit RGB pixels in test/images/.
+ *
+ * @param width
+ *          The width of the image
+ * @param height
+ *          The height of the image
+ * @param rgb
+ *          The red, green and blue value of every pixel, 3 * width * height bytes
+ * @param name
+ *          The file name with extension (.ppm)
+*/
+void createPixmapImage(size_t width, size_t height, const uint8_t * rgb, char * name);
+
 
 template <typename T, typename F> void fillFloatArrayRandomTemp(T &array){
     srand((unsigned int)time(NULL));
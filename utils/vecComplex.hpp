@@ -1,27 +1,75 @@
 #ifndef vecComplex
 #define vecComplex
 
+#include <stddef.h>
+
+/* The lane operations of VecComplex for scalar types. Vector types use the backends of
+ * mandelbrot/mandelbrotEscapeTimeEngine.hpp instead, which have the same interface. */
 template <typename T>
+struct VecComplexOps {
+    typedef bool M;
+
+    static size_t lanes() { return 1; }
+    static T set(float x) { return x; }
+    // Lanes first, first + 1, first + 2, ...
+    static T iota(size_t first) { return (T) first; }
+    static void store(T v, float * p) { *p = v; }
+
+    static T add(T a, T b) { return a + b; }
+    static T sub(T a, T b) { return a - b; }
+    static T mul(T a, T b) { return a * b; }
+    static M lt(T a, T b) { return a < b; }
+    static T select(M m, T a, T b) { return m ? a : b; }
+    static bool none(M m) { return !m; }
+};
+
+template <typename T, typename Ops = VecComplexOps<T>>
 class VecComplex {
     public:
+        typedef typename Ops::M Mask;
+
         VecComplex(T real, T imag)
             : cached_real(real), cached_imag(imag),
-            cached_real_sqared(real * real), cached_imag_squared(imag * imag) {}
+            cached_real_sqared(Ops::mul(real, real)), cached_imag_squared(Ops::mul(imag, imag)) {}
 
         VecComplex mandelIterate(T c_real, T c_imag) {
-            return VecComplex(cached_real_sqared - cached_imag_squared + c_real,
-                              ((cached_real + cached_real) * cached_imag) + c_imag);
+            T temp = Ops::mul(cached_real, cached_imag);
+            return VecComplex(Ops::add(Ops::sub(cached_real_sqared, cached_imag_squared), c_real),
+                              Ops::add(Ops::add(temp, temp), c_imag));
+        }
+
+        // Only the active lanes are iterated, the others keep their value, e.g. after they escaped
+        VecComplex mandelIterate(T c_real, T c_imag, Mask active) {
+            VecComplex next = mandelIterate(c_real, c_imag);
+            return VecComplex(Ops::select(active, next.cached_real, cached_real),
+                              Ops::select(active, next.cached_imag, cached_imag),
+                              Ops::select(active, next.cached_real_sqared, cached_real_sqared),
+                              Ops::select(active, next.cached_imag_squared, cached_imag_squared));
         }
 
         T norm() {
-            return cached_real_sqared + cached_imag_squared;
+            return Ops::add(cached_real_sqared, cached_imag_squared);
+        }
+
+        // The norm of the active lanes, the others are zero
+        T norm(Mask active) {
+            return Ops::select(active, norm(), Ops::set(0.0f));
+        }
+
+        // The lanes whose squared norm is below the bailout
+        Mask bounded(T bailout) {
+            return Ops::lt(norm(), bailout);
         }
 
     private:
+        VecComplex(T real, T imag, T real_squared, T imag_squared)
+            : cached_real(real), cached_imag(imag),
+            cached_real_sqared(real_squared), cached_imag_squared(imag_squared) {}
+
         T cached_real;
         T cached_imag;
         T cached_real_sqared;
         T cached_imag_squared;
 };
 
-#endif
\ No newline at end of file
+#endif